@@ -0,0 +1,244 @@
+#include "AllocationTracker.h"
+
+#ifdef ASO_TRACK_ALLOCATIONS
+
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>  // _aligned_malloc
+#endif
+
+// Scope 0 collects everything outside a scope
+const int MAX_SCOPES = 32;
+
+// Frames averaged into one report line
+const int REPORT_FRAMES = 60;
+
+// Everything here is zero- or constant-initialized: operator new can run before main
+struct ScopeStats {
+    const char* name;
+
+    // This frame, any thread
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> frees;
+    std::atomic<uint32_t> budgetViolations;
+    std::atomic<uint64_t> budgetWorst;
+
+    // Report window (main thread)
+    uint64_t windowAllocations;
+    uint64_t windowBytes;
+    uint64_t windowFrees;
+    uint64_t worstFrame;
+};
+
+static ScopeStats s_scopes[MAX_SCOPES];
+static std::atomic<int> s_scopeCount(1);
+static std::mutex s_registerMutex;
+static std::atomic<bool> s_assertOnBudget(false);
+static int s_frameCount = 0;
+
+static thread_local int t_scope = 0;
+static thread_local uint64_t t_allocations = 0;
+
+static void* countedAllocate(size_t size, size_t alignment = 0) noexcept {
+    void* memory;
+    if (alignment == 0) {
+        memory = std::malloc(size > 0 ? size : 1);
+    } else {
+        // aligned_alloc wants a size that is a multiple of the alignment
+        size_t rounded = (std::max<size_t>(size, 1) + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+        memory = _aligned_malloc(rounded, alignment);
+#else
+        memory = std::aligned_alloc(alignment, rounded);
+#endif
+    }
+    if (memory) {
+        ScopeStats& stats = s_scopes[t_scope];
+        stats.allocations.fetch_add(1, std::memory_order_relaxed);
+        stats.bytes.fetch_add(size, std::memory_order_relaxed);
+        t_allocations++;
+    }
+    return memory;
+}
+
+static void countedFree(void* memory, bool aligned = false) noexcept {
+    if (memory) {
+        s_scopes[t_scope].frees.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+        if (aligned) {
+            _aligned_free(memory);
+            return;
+        }
+#else
+        (void)aligned;
+#endif
+        std::free(memory);
+    }
+}
+
+void* operator new(size_t size) {
+    void* memory = countedAllocate(size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](size_t size) {
+    void* memory = countedAllocate(size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size); }
+void operator delete(void* memory) noexcept { countedFree(memory); }
+void operator delete[](void* memory) noexcept { countedFree(memory); }
+void operator delete(void* memory, size_t) noexcept { countedFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { countedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { countedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { countedFree(memory); }
+
+// Aligned forms: over-aligned types, and FrameArena's heap overflow
+void* operator new(size_t size, std::align_val_t alignment) {
+    void* memory = countedAllocate(size, static_cast<size_t>(alignment));
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    void* memory = countedAllocate(size, static_cast<size_t>(alignment));
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<size_t>(alignment));
+}
+void operator delete(void* memory, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete[](void* memory, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { countedFree(memory, true); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { countedFree(memory, true); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { countedFree(memory, true); }
+
+int AllocationTracker::registerScope(const char* name) {
+    std::lock_guard<std::mutex> lock(s_registerMutex);
+    int count = s_scopeCount.load(std::memory_order_relaxed);
+    for (int i = 1; i < count; i++) {
+        if (s_scopes[i].name == name || std::strcmp(s_scopes[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (count >= MAX_SCOPES) {
+        SDL_Log("WARNING: Too many allocation scopes, counting %s as untagged", name);
+        return 0;
+    }
+    s_scopes[count].name = name;
+    s_scopeCount.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+void AllocationTracker::setAssertOnBudget(bool enabled) {
+    s_assertOnBudget = enabled;
+}
+
+uint64_t AllocationTracker::getThreadAllocationCount() {
+    return t_allocations;
+}
+
+void AllocationTracker::reportBudget(int scope, uint64_t used, uint64_t budget) {
+    if (used <= budget) {
+        return;
+    }
+    ScopeStats& stats = s_scopes[scope];
+    stats.budgetViolations.fetch_add(1, std::memory_order_relaxed);
+    uint64_t worst = stats.budgetWorst.load(std::memory_order_relaxed);
+    while (used > worst && !stats.budgetWorst.compare_exchange_weak(worst, used, std::memory_order_relaxed)) {
+    }
+
+    if (s_assertOnBudget) {
+        SDL_Log("WARNING: Allocation budget [%s] exceeded: %llu allocations (budget %llu)",
+                stats.name, static_cast<unsigned long long>(used), static_cast<unsigned long long>(budget));
+        SDL_assert_always(used <= budget);
+    }
+}
+
+void AllocationTracker::endFrame() {
+    int count = s_scopeCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; i++) {
+        ScopeStats& stats = s_scopes[i];
+        uint64_t allocations = stats.allocations.exchange(0, std::memory_order_relaxed);
+        stats.windowAllocations += allocations;
+        stats.windowBytes += stats.bytes.exchange(0, std::memory_order_relaxed);
+        stats.windowFrees += stats.frees.exchange(0, std::memory_order_relaxed);
+        stats.worstFrame = std::max(stats.worstFrame, allocations);
+    }
+    if (++s_frameCount < REPORT_FRAMES) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        ScopeStats& stats = s_scopes[i];
+        const char* name = i == 0 ? "untagged" : stats.name;
+        if (stats.windowAllocations > 0) {
+            SDL_Log("INFO: Allocations [%s]: %.1f/frame, %.0f bytes/frame, worst frame %llu, %.1f frees/frame",
+                    name,
+                    static_cast<double>(stats.windowAllocations) / s_frameCount,
+                    static_cast<double>(stats.windowBytes) / s_frameCount,
+                    static_cast<unsigned long long>(stats.worstFrame),
+                    static_cast<double>(stats.windowFrees) / s_frameCount);
+        }
+        uint32_t violations = stats.budgetViolations.exchange(0, std::memory_order_relaxed);
+        if (violations > 0) {
+            SDL_Log("WARNING: Allocation budget [%s] exceeded %u times in the last %d frames (worst %llu allocations)",
+                    name, violations, s_frameCount,
+                    static_cast<unsigned long long>(stats.budgetWorst.exchange(0, std::memory_order_relaxed)));
+        }
+        stats.windowAllocations = 0;
+        stats.windowBytes = 0;
+        stats.windowFrees = 0;
+        stats.worstFrame = 0;
+    }
+    s_frameCount = 0;
+}
+
+AllocationScope::AllocationScope(int scope)
+    : m_previous(t_scope)
+{
+    t_scope = scope;
+}
+
+AllocationScope::~AllocationScope() {
+    t_scope = m_previous;
+}
+
+AllocationBudget::AllocationBudget(int scope, uint64_t budget)
+    : m_scope(scope)
+    , m_budget(budget)
+    , m_start(t_allocations)
+{
+}
+
+AllocationBudget::~AllocationBudget() {
+    AllocationTracker::reportBudget(m_scope, t_allocations - m_start, m_budget);
+}
+
+#endif
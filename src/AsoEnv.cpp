@@ -0,0 +1,230 @@
+#include "AsoEnv.h"
+#include "Game.h"
+#include "SteerDirections.h"
+#include <algorithm>
+#include <cstring>
+
+const float STEP_SECONDS = 1.0f / 60.0f;  // Same tick as the simulation thread
+
+const float REWARD_PER_POINT = 0.01f;  // Enemy 0.1, boss 10
+const float LIFE_PENALTY = 1.0f;
+const float BULLET_SPEED_SCALE = 1.0f / 400.0f;
+
+// Keeps the N smallest distances seen so far, sorted (N is small)
+template <int N>
+struct NearestSet {
+    float distance[N];
+    uint32_t index[N];
+    int count = 0;
+
+    void insert(float d, uint32_t i) {
+        if (count == N && d >= distance[N - 1]) {
+            return;
+        }
+        int slot = count < N ? count++ : N - 1;
+        while (slot > 0 && distance[slot - 1] > d) {
+            distance[slot] = distance[slot - 1];
+            index[slot] = index[slot - 1];
+            slot--;
+        }
+        distance[slot] = d;
+        index[slot] = i;
+    }
+};
+
+AsoEnv::AsoEnv(int frameSkip, int maxSteps)
+    : m_game(std::make_unique<Game>(0u))
+    , m_frameSkip(frameSkip > 0 ? frameSkip : 1)
+    , m_maxSteps(maxSteps)
+    , m_steps(0)
+    , m_lastScore(0)
+    , m_lastLives(0)
+    , m_done(true)
+{
+    m_game->initHeadless(Game::FIELD_WIDTH, Game::FIELD_HEIGHT, 0);
+    std::fill(m_observation, m_observation + OBSERVATION_SIZE, 0.0f);
+}
+
+AsoEnv::~AsoEnv() = default;
+
+const float* AsoEnv::reset(uint64_t seed) {
+    Game& game = *m_game;
+    game.startSession(seed);
+    skipUncontrolled();
+
+    m_steps = 0;
+    m_lastScore = game.m_score;
+    m_lastLives = game.m_lives;
+    m_done = false;
+    observe(m_observation);
+    return m_observation;
+}
+
+AsoEnv::StepResult AsoEnv::step(int action) {
+    if (m_done) {
+        return {m_observation, 0.0f, true};
+    }
+
+    Game& game = *m_game;
+    const Player& player = *game.m_player;
+    int direction = action % MOVE_DIRECTIONS;
+    float centerX = player.getX() + player.getWidth() / 2;
+    float centerY = player.getY() + player.getHeight() / 2;
+    game.m_player->setMousePosition(centerX + STEER_X[direction] * STEER_DISTANCE,
+                                    centerY + STEER_Y[direction] * STEER_DISTANCE);
+    game.m_mousePressed = action / MOVE_DIRECTIONS != 0;
+
+    for (int i = 0; i < m_frameSkip && game.m_gameState == Game::GameState::PLAYING; i++) {
+        game.update(STEP_SECONDS);
+    }
+    skipUncontrolled();
+
+    float reward = (game.m_score - m_lastScore) * REWARD_PER_POINT - (m_lastLives - game.m_lives) * LIFE_PENALTY;
+    m_lastScore = game.m_score;
+    m_lastLives = game.m_lives;
+    m_steps++;
+    m_done = game.m_gameState == Game::GameState::GAME_OVER || (m_maxSteps > 0 && m_steps >= m_maxSteps);
+
+    observe(m_observation);
+    return {m_observation, reward, m_done};
+}
+
+int AsoEnv::getScore() const {
+    return m_game->m_score;
+}
+
+int AsoEnv::getStage() const {
+    return m_game->m_currentStage;
+}
+
+void AsoEnv::skipUncontrolled() {
+    // Countdown and the player explosion ignore input; the agent only sees controllable frames
+    Game& game = *m_game;
+    while (game.m_gameState == Game::GameState::COUNTDOWN || game.m_gameState == Game::GameState::EXPLODING) {
+        game.update(STEP_SECONDS);
+    }
+}
+
+void AsoEnv::observe(float* out) const {
+    const Game& game = *m_game;
+    const Player& player = *game.m_player;
+    float invWidth = 1.0f / game.m_windowWidth;
+    float invHeight = 1.0f / game.m_windowHeight;
+    float playerX = player.getX() + player.getWidth() / 2;
+    float playerY = player.getY() + player.getHeight() / 2;
+
+    *out++ = playerX * invWidth;
+    *out++ = playerY * invHeight;
+    *out++ = player.getMaxEnergy() > 0 ? static_cast<float>(player.getEnergy()) / player.getMaxEnergy() : 0.0f;
+    *out++ = game.m_lives / 3.0f;
+    *out++ = player.getSpeedLevel() / 3.0f;
+    *out++ = player.getLaserLevel() / 3.0f;
+    *out++ = player.getMissileLevel() / 4.0f;
+
+    NearestSet<NEAREST_ENEMIES> enemies;
+    for (size_t i = 0; i < game.m_enemies.size(); i++) {
+        const Enemy& enemy = *game.m_enemies[i];
+        float dx = enemy.getX() + enemy.getWidth() / 2 - playerX;
+        float dy = enemy.getY() + enemy.getHeight() / 2 - playerY;
+        enemies.insert(dx * dx + dy * dy, static_cast<uint32_t>(i));
+    }
+    for (int k = 0; k < NEAREST_ENEMIES; k++) {
+        if (k < enemies.count) {
+            const Enemy& enemy = *game.m_enemies[enemies.index[k]];
+            *out++ = (enemy.getX() + enemy.getWidth() / 2 - playerX) * invWidth;
+            *out++ = (enemy.getY() + enemy.getHeight() / 2 - playerY) * invHeight;
+            *out++ = 1.0f;
+        } else {
+            for (int f = 0; f < ENEMY_FEATURES; f++) {
+                *out++ = 0.0f;
+            }
+        }
+    }
+
+    NearestSet<NEAREST_BULLETS> bullets;
+    for (size_t i = 0; i < game.m_enemyBullets.size(); i++) {
+        const Bullet& bullet = game.m_enemyBullets[i];
+        float dx = bullet.getX() + bullet.getWidth() / 2 - playerX;
+        float dy = bullet.getY() + bullet.getHeight() / 2 - playerY;
+        bullets.insert(dx * dx + dy * dy, static_cast<uint32_t>(i));
+    }
+    for (int k = 0; k < NEAREST_BULLETS; k++) {
+        if (k < bullets.count) {
+            const Bullet& bullet = game.m_enemyBullets[bullets.index[k]];
+            *out++ = (bullet.getX() + bullet.getWidth() / 2 - playerX) * invWidth;
+            *out++ = (bullet.getY() + bullet.getHeight() / 2 - playerY) * invHeight;
+            *out++ = bullet.getVelocityX() * BULLET_SPEED_SCALE;
+            *out++ = bullet.getVelocityY() * BULLET_SPEED_SCALE;
+            *out++ = 1.0f;
+        } else {
+            for (int f = 0; f < BULLET_FEATURES; f++) {
+                *out++ = 0.0f;
+            }
+        }
+    }
+
+    if (game.m_boss) {
+        const Boss& boss = *game.m_boss;
+        *out++ = 1.0f;
+        *out++ = (boss.getWeakPointX() + boss.getWeakPointWidth() / 2 - playerX) * invWidth;
+        *out++ = (boss.getWeakPointY() + boss.getWeakPointHeight() / 2 - playerY) * invHeight;
+        *out++ = boss.getMaxHealth() > 0 ? static_cast<float>(boss.getHealth()) / boss.getMaxHealth() : 0.0f;
+        *out++ = boss.getState() == Boss::BossState::FIGHTING ? 1.0f : 0.0f;
+    } else {
+        for (int f = 0; f < BOSS_FEATURES; f++) {
+            *out++ = 0.0f;
+        }
+    }
+}
+
+AsoVecEnv::AsoVecEnv(int envCount, int frameSkip, int maxSteps, unsigned threadCount)
+    : m_jobs(JobSystem::workerCountFor(threadCount))
+    , m_observations(static_cast<size_t>(envCount) * AsoEnv::OBSERVATION_SIZE, 0.0f)
+    , m_rewards(envCount, 0.0f)
+    , m_dones(envCount, 0)
+    , m_nextSeeds(envCount, 0)
+    , m_episodes(0)
+{
+    m_envs.reserve(envCount);
+    for (int i = 0; i < envCount; i++) {
+        m_envs.push_back(std::make_unique<AsoEnv>(frameSkip, maxSteps));
+    }
+    SDL_Log("INFO: Vector env: %d games on %u threads", envCount, m_jobs.getThreadCount());
+}
+
+AsoVecEnv::~AsoVecEnv() = default;
+
+void AsoVecEnv::reset(uint64_t seed) {
+    size_t count = m_envs.size();
+    m_jobs.parallelFor(count, 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            const float* observation = m_envs[i]->reset(seed + i);
+            std::memcpy(&m_observations[i * AsoEnv::OBSERVATION_SIZE], observation, sizeof(float) * AsoEnv::OBSERVATION_SIZE);
+            m_rewards[i] = 0.0f;
+            m_dones[i] = 0;
+            m_nextSeeds[i] = seed + i + count;
+        }
+    });
+    m_episodes = 0;
+}
+
+void AsoVecEnv::step(const int* actions) {
+    size_t count = m_envs.size();
+    m_jobs.parallelFor(count, 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            AsoEnv& env = *m_envs[i];
+            AsoEnv::StepResult result = env.step(actions[i]);
+            const float* observation = result.observation;
+            if (result.done) {
+                observation = env.reset(m_nextSeeds[i]);
+                m_nextSeeds[i] += count;
+            }
+            std::memcpy(&m_observations[i * AsoEnv::OBSERVATION_SIZE], observation, sizeof(float) * AsoEnv::OBSERVATION_SIZE);
+            m_rewards[i] = result.reward;
+            m_dones[i] = result.done ? 1 : 0;
+        }
+    });
+    for (uint8_t done : m_dones) {
+        m_episodes += done;
+    }
+}
@@ -0,0 +1,191 @@
+#include "AssetArchive.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+AssetArchive::AssetArchive()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_entries(nullptr)
+    , m_entryCount(0)
+#ifdef _WIN32
+    , m_file(nullptr)
+    , m_mapping(nullptr)
+#endif
+{
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+uint64_t AssetArchive::hash(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t value = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        value ^= bytes[i];
+        value *= 1099511628211ULL;
+    }
+    return value;
+}
+
+std::string AssetArchive::getFileName(const std::string& path) {
+    std::string::size_type pos = path.find_last_of("\\/");
+    return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+uint64_t AssetArchive::hashName(const std::string& path) {
+    std::string name = getFileName(path);
+    return hash(name.data(), name.size());
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = NULL;
+    const void* view = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+    }
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    void* view = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);  // The mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(info.st_size);
+#endif
+
+    if (!validate()) {
+        SDL_Log("WARNING: Ignoring malformed asset archive: %s", path.c_str());
+        close();
+        return false;
+    }
+    SDL_Log("INFO: Mapped asset archive: %s (%u entries, %zu bytes)", path.c_str(), m_entryCount, m_size);
+    return true;
+}
+
+void AssetArchive::close() {
+    if (m_data) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        CloseHandle(static_cast<HANDLE>(m_file));
+        m_mapping = nullptr;
+        m_file = nullptr;
+#else
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_entries = nullptr;
+    m_entryCount = 0;
+}
+
+bool AssetArchive::validate() {
+    if (m_size < sizeof(Header)) {
+        return false;
+    }
+    const Header* header = reinterpret_cast<const Header*>(m_data);
+    if (header->magic != MAGIC || header->version != VERSION) {
+        return false;
+    }
+    if (header->entryCount > (m_size - sizeof(Header)) / sizeof(Entry)) {
+        return false;
+    }
+
+    // Every blob must lie inside the file, and images must hold their pixels
+    const Entry* entries = reinterpret_cast<const Entry*>(m_data + sizeof(Header));
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        const Entry& entry = entries[i];
+        if (entry.offset > m_size || entry.size > m_size - entry.offset) {
+            return false;
+        }
+        if (entry.name[MAX_NAME_LENGTH] != '\0') {
+            return false;
+        }
+        if (entry.type == AssetType::IMAGE &&
+            static_cast<uint64_t>(entry.pitch) * entry.height > entry.size) {
+            return false;
+        }
+        if (i > 0 && entries[i - 1].nameHash > entry.nameHash) {
+            return false;
+        }
+    }
+
+    m_entries = entries;
+    m_entryCount = header->entryCount;
+    return true;
+}
+
+const AssetArchive::Entry* AssetArchive::find(const std::string& path) const {
+    if (!m_entries) {
+        return nullptr;
+    }
+    std::string name = getFileName(path);
+    uint64_t nameHash = hash(name.data(), name.size());
+    const Entry* end = m_entries + m_entryCount;
+    const Entry* entry = std::lower_bound(m_entries, end, nameHash,
+        [](const Entry& e, uint64_t value) { return e.nameHash < value; });
+    for (; entry != end && entry->nameHash == nameHash; ++entry) {
+        if (name == entry->name) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+SDL_Surface* AssetArchive::createSurface(const std::string& path) const {
+    const Entry* entry = find(path);
+    if (!entry || entry->type != AssetType::IMAGE) {
+        return nullptr;
+    }
+    // SDL never writes to a surface it is only uploading from
+    void* pixels = const_cast<uint8_t*>(getData(*entry));
+    return SDL_CreateRGBSurfaceWithFormatFrom(pixels, static_cast<int>(entry->width), static_cast<int>(entry->height),
+                                              32, static_cast<int>(entry->pitch), entry->pixelFormat);
+}
+
+SDL_RWops* AssetArchive::openRW(const std::string& path) const {
+    const Entry* entry = find(path);
+    if (!entry) {
+        return nullptr;
+    }
+    return SDL_RWFromConstMem(getData(*entry), static_cast<int>(entry->size));
+}
@@ -0,0 +1,185 @@
+#include "AudioCache.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+
+static void putLE16(uint8_t* out, uint32_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+static void putLE32(uint8_t* out, uint32_t value) {
+    putLE16(out, value);
+    putLE16(out + 2, value >> 16);
+}
+
+AudioCache::AudioCache()
+    : m_enabled(false)
+    , m_frequency(0)
+    , m_format(0)
+    , m_channels(0)
+    , m_archive(nullptr)
+{
+}
+
+bool AudioCache::open(const std::string& directory, const AssetArchive* archive) {
+    m_enabled = false;
+    m_directory = directory;
+    m_archive = archive;
+
+    if (!Mix_QuerySpec(&m_frequency, &m_format, &m_channels)) {
+        return false;
+    }
+    // Cache files are WAVs, which are little-endian
+    if (m_format != AUDIO_U8 && m_format != AUDIO_S16LSB && m_format != AUDIO_S32LSB && m_format != AUDIO_F32LSB) {
+        SDL_Log("INFO: Audio cache disabled for mixer format 0x%04x", m_format);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        SDL_Log("WARNING: Audio cache directory unavailable: %s (%s)", m_directory.c_str(), error.message().c_str());
+        return false;
+    }
+
+    m_enabled = true;
+    return true;
+}
+
+Mix_Chunk* AudioCache::loadChunk(const std::string& path) const {
+    uint64_t hash = 0;
+    void* fileData = nullptr;
+    size_t fileSize = 0;
+    if (!m_enabled || !getSourceHash(path, hash, fileData, fileSize)) {
+        return nullptr;
+    }
+    std::string cachePath = getCachePath(hash);
+
+    size_t pcmSize = 0;
+    if (uint8_t* buffer = readCache(cachePath, pcmSize)) {
+        SDL_free(fileData);
+
+        // The chunk takes the buffer; Mix_FreeChunk releases it with SDL_free
+        Mix_Chunk* chunk = static_cast<Mix_Chunk*>(SDL_malloc(sizeof(Mix_Chunk)));
+        if (!chunk) {
+            SDL_free(buffer);
+            return nullptr;
+        }
+        std::memmove(buffer, buffer + WAV_HEADER_SIZE, pcmSize);
+        chunk->allocated = 1;
+        chunk->abuf = buffer;
+        chunk->alen = static_cast<Uint32>(pcmSize);
+        chunk->volume = MIX_MAX_VOLUME;
+        return chunk;
+    }
+
+    // First run: decode once, already converted to the mixer format
+    Mix_Chunk* chunk = decode(path, fileData, fileSize);
+    SDL_free(fileData);
+    if (chunk) {
+        std::vector<uint8_t> wav(WAV_HEADER_SIZE + chunk->alen);
+        writeWavHeader(wav.data(), chunk->alen);
+        std::memcpy(wav.data() + WAV_HEADER_SIZE, chunk->abuf, chunk->alen);
+        writeCache(cachePath, wav.data(), wav.size());
+    }
+    return chunk;
+}
+
+bool AudioCache::getSourceHash(const std::string& path, uint64_t& hash, void*& fileData, size_t& fileSize) const {
+    // The archive index already carries the content hash
+    if (m_archive) {
+        if (const AssetArchive::Entry* entry = m_archive->find(path)) {
+            hash = entry->contentHash;
+            return true;
+        }
+    }
+
+    fileData = SDL_LoadFile(path.c_str(), &fileSize);
+    if (!fileData) {
+        return false;
+    }
+    hash = AssetArchive::hash(fileData, fileSize);
+    return true;
+}
+
+std::string AudioCache::getCachePath(uint64_t hash) const {
+    // Spec is part of the name so a different mixer format never reads stale PCM
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx-%d-%04x-%d.wav",
+                  static_cast<unsigned long long>(hash), m_frequency, m_format, m_channels);
+    return m_directory + "/" + name;
+}
+
+Mix_Chunk* AudioCache::decode(const std::string& path, void* fileData, size_t fileSize) const {
+    SDL_RWops* rw = fileData ? SDL_RWFromConstMem(fileData, static_cast<int>(fileSize)) : m_archive->openRW(path);
+    if (!rw) {
+        return nullptr;
+    }
+    Mix_Chunk* chunk = Mix_LoadWAV_RW(rw, 1);
+    if (chunk) {
+        SDL_Log("INFO: Decoded %s into the audio cache (%u bytes PCM)", AssetArchive::getFileName(path).c_str(), chunk->alen);
+    }
+    return chunk;
+}
+
+uint8_t* AudioCache::readCache(const std::string& cachePath, size_t& pcmSize) const {
+    size_t size = 0;
+    uint8_t* buffer = static_cast<uint8_t*>(SDL_LoadFile(cachePath.c_str(), &size));
+    if (!buffer) {
+        return nullptr;
+    }
+
+    // Must be exactly the header this spec would write
+    uint8_t expected[WAV_HEADER_SIZE];
+    if (size >= WAV_HEADER_SIZE) {
+        writeWavHeader(expected, size - WAV_HEADER_SIZE);
+    }
+    if (size < WAV_HEADER_SIZE || std::memcmp(buffer, expected, WAV_HEADER_SIZE) != 0) {
+        SDL_Log("WARNING: Ignoring corrupt audio cache file: %s", cachePath.c_str());
+        SDL_free(buffer);
+        return nullptr;
+    }
+    pcmSize = size - WAV_HEADER_SIZE;
+    return buffer;
+}
+
+void AudioCache::writeWavHeader(uint8_t* header, size_t pcmSize) const {
+    uint32_t bits = SDL_AUDIO_BITSIZE(m_format);
+    uint32_t blockAlign = static_cast<uint32_t>(m_channels) * bits / 8;
+
+    std::memcpy(header, "RIFF", 4);
+    putLE32(header + 4, static_cast<uint32_t>(36 + pcmSize));
+    std::memcpy(header + 8, "WAVE", 4);
+    std::memcpy(header + 12, "fmt ", 4);
+    putLE32(header + 16, 16);
+    putLE16(header + 20, SDL_AUDIO_ISFLOAT(m_format) ? 3 : 1);  // IEEE float / PCM
+    putLE16(header + 22, static_cast<uint32_t>(m_channels));
+    putLE32(header + 24, static_cast<uint32_t>(m_frequency));
+    putLE32(header + 28, static_cast<uint32_t>(m_frequency) * blockAlign);
+    putLE16(header + 32, blockAlign);
+    putLE16(header + 34, bits);
+    std::memcpy(header + 36, "data", 4);
+    putLE32(header + 40, static_cast<uint32_t>(pcmSize));
+}
+
+void AudioCache::writeCache(const std::string& cachePath, const uint8_t* wav, size_t wavSize) const {
+    // Write to a temporary name first so a crash never leaves a truncated cache file
+    std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(wav), static_cast<std::streamsize>(wavSize));
+        if (!file) {
+            SDL_Log("WARNING: Failed to write audio cache file: %s", tempPath.c_str());
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, cachePath, error);
+    if (error) {
+        SDL_Log("WARNING: Failed to store audio cache file: %s (%s)", cachePath.c_str(), error.message().c_str());
+        std::filesystem::remove(tempPath, error);
+    }
+}
@@ -0,0 +1,186 @@
+#include "AudioVoiceManager.h"
+#include <algorithm>
+#include <cmath>
+
+// Identical triggers in one tick play once, up to this much louder
+const float MAX_BATCH_GAIN = 2.0f;
+
+// Hard left/right edge of the field leaves this much in the far ear
+const float MIN_PAN_GAIN = 0.3f;
+
+// Attenuation reaches its floor one field height away from the listener
+const float MIN_DISTANCE_GAIN = 0.4f;
+
+AudioVoiceManager::AudioVoiceManager()
+    : m_spatial(false)
+    , m_fieldWidth(1.0f)
+    , m_fieldHeight(1.0f)
+    , m_listenerX(0.0f)
+    , m_listenerY(0.0f)
+    , m_time(0.0f)
+{
+    for (int i = 0; i < static_cast<int>(SoundId::COUNT); i++) {
+        m_sounds[i] = {nullptr, 0, 1, 0.0f, MIX_MAX_VOLUME, -1000.0f};
+        m_pending[i] = 0;
+        m_pendingX[i] = 0.0f;
+        m_pendingY[i] = 0.0f;
+        m_flushOrder[i] = static_cast<SoundId>(i);
+    }
+}
+
+void AudioVoiceManager::init(int channelCount, float fieldWidth, float fieldHeight) {
+    int allocated = Mix_AllocateChannels(channelCount);
+    m_voices.assign(allocated, {SoundId::COUNT, 0, 0.0f});
+    m_gains.assign(allocated, {1.0f, 1.0f});
+    m_fieldWidth = std::max(1.0f, fieldWidth);
+    m_fieldHeight = std::max(1.0f, fieldHeight);
+    m_listenerX = m_fieldWidth / 2;
+    m_listenerY = m_fieldHeight;
+
+    int frequency = 0;
+    Uint16 format = 0;
+    int channels = 0;
+    m_spatial = Mix_QuerySpec(&frequency, &format, &channels) && format == AUDIO_S16SYS && channels == 2;
+    if (m_spatial) {
+        // The effect carries the whole volume, channels stay at full scale
+        for (int channel = 0; channel < allocated; channel++) {
+            Mix_Volume(channel, MIX_MAX_VOLUME);
+        }
+    }
+    SDL_Log("INFO: Audio voice manager using %d channels (%s)", allocated, m_spatial ? "positional" : "centered");
+}
+
+void AudioVoiceManager::registerSound(SoundId sound, Mix_Chunk* chunk, int priority, int maxVoices, float minInterval, int volume) {
+    SoundConfig& config = m_sounds[static_cast<int>(sound)];
+    config.chunk = chunk;
+    config.priority = priority;
+    config.maxVoices = std::max(1, maxVoices);
+    config.minInterval = minInterval;
+    config.volume = volume;
+
+    std::stable_sort(m_flushOrder, m_flushOrder + static_cast<int>(SoundId::COUNT), [this](SoundId a, SoundId b) {
+        return m_sounds[static_cast<int>(a)].priority > m_sounds[static_cast<int>(b)].priority;
+    });
+}
+
+void AudioVoiceManager::flush(float deltaTime) {
+    m_time += deltaTime;
+
+    for (SoundId sound : m_flushOrder) {
+        int index = static_cast<int>(sound);
+        int count = m_pending[index];
+        float x = count > 0 ? m_pendingX[index] / count : 0.0f;
+        float y = count > 0 ? m_pendingY[index] / count : 0.0f;
+        m_pending[index] = 0;
+        m_pendingX[index] = 0.0f;
+        m_pendingY[index] = 0.0f;
+
+        SoundConfig& config = m_sounds[index];
+        if (count == 0 || !config.chunk) {
+            continue;
+        }
+        // Too soon after the last start: the running voice covers it
+        if (m_time - config.lastStart < config.minInterval) {
+            continue;
+        }
+
+        int channel = pickChannel(sound, config);
+        if (channel < 0) {
+            continue;  // Everything busy with sounds that matter more
+        }
+
+        float gain = std::min(MAX_BATCH_GAIN, std::sqrt(static_cast<float>(count)));
+        float volume = std::min(1.0f, config.volume * gain / MIX_MAX_VOLUME);
+        bool started;
+        if (m_spatial) {
+            // Playing a channel drops its effects, so the callback is attached again right after.
+            // The audio lock keeps the mixer from running this channel in between or reading half-written gains.
+            SDL_LockAudio();
+            computeGains(x, y, volume, m_gains[channel]);
+            started = Mix_PlayChannel(channel, config.chunk, 0) >= 0;
+            if (started) {
+                Mix_RegisterEffect(channel, &AudioVoiceManager::spatialEffect, nullptr, &m_gains[channel]);
+            }
+            SDL_UnlockAudio();
+        } else {
+            Mix_Volume(channel, static_cast<int>(volume * MIX_MAX_VOLUME));
+            started = Mix_PlayChannel(channel, config.chunk, 0) >= 0;
+        }
+        if (started) {
+            m_voices[channel] = {sound, config.priority, m_time};
+            config.lastStart = m_time;
+        }
+    }
+}
+
+void AudioVoiceManager::computeGains(float x, float y, float volume, ChannelGains& gains) const {
+    // Linear balance: the centre is untouched, the edges fade out the far ear
+    float pan = std::max(-1.0f, std::min(1.0f, x / m_fieldWidth * 2.0f - 1.0f));
+    float left = pan > 0.0f ? 1.0f - pan * (1.0f - MIN_PAN_GAIN) : 1.0f;
+    float right = pan < 0.0f ? 1.0f + pan * (1.0f - MIN_PAN_GAIN) : 1.0f;
+
+    float distance = std::hypot(x - m_listenerX, y - m_listenerY);
+    float attenuation = std::max(MIN_DISTANCE_GAIN, 1.0f - distance / m_fieldHeight * (1.0f - MIN_DISTANCE_GAIN));
+
+    gains.left = left * attenuation * volume;
+    gains.right = right * attenuation * volume;
+}
+
+void AudioVoiceManager::spatialEffect(int channel, void* stream, int length, void* userData) {
+    (void)channel;
+    const ChannelGains& gains = *static_cast<const ChannelGains*>(userData);
+    int16_t* samples = static_cast<int16_t*>(stream);
+    int count = length / static_cast<int>(sizeof(int16_t));
+    for (int i = 0; i + 1 < count; i += 2) {
+        samples[i] = static_cast<int16_t>(samples[i] * gains.left);
+        samples[i + 1] = static_cast<int16_t>(samples[i + 1] * gains.right);
+    }
+}
+
+int AudioVoiceManager::pickChannel(SoundId sound, const SoundConfig& config) const {
+    int freeChannel = -1;
+    int active = 0;
+    int oldestOwn = -1;
+    int victim = -1;
+    for (int channel = 0; channel < static_cast<int>(m_voices.size()); channel++) {
+        if (!Mix_Playing(channel)) {
+            if (freeChannel < 0) {
+                freeChannel = channel;
+            }
+            continue;
+        }
+
+        const Voice& voice = m_voices[channel];
+        if (voice.sound == sound) {
+            active++;
+            if (oldestOwn < 0 || voice.startTime < m_voices[oldestOwn].startTime) {
+                oldestOwn = channel;
+            }
+        } else if (voice.priority < config.priority) {
+            // Lowest priority first, then the voice that has played longest
+            if (victim < 0 || voice.priority < m_voices[victim].priority ||
+                (voice.priority == m_voices[victim].priority && voice.startTime < m_voices[victim].startTime)) {
+                victim = channel;
+            }
+        }
+    }
+
+    if (active >= config.maxVoices) {
+        return oldestOwn;  // At the cap: restart our own oldest voice
+    }
+    if (freeChannel >= 0) {
+        return freeChannel;
+    }
+    return victim;
+}
+
+void AudioVoiceManager::stopAll() {
+    for (int channel = 0; channel < static_cast<int>(m_voices.size()); channel++) {
+        Mix_HaltChannel(channel);
+    }
+    for (int i = 0; i < static_cast<int>(SoundId::COUNT); i++) {
+        m_pending[i] = 0;
+        m_pendingX[i] = 0.0f;
+        m_pendingY[i] = 0.0f;
+    }
+}
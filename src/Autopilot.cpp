@@ -0,0 +1,169 @@
+#include "Autopilot.h"
+#include "SteerDirections.h"
+#include <algorithm>
+#include <cmath>
+
+const float LOOKAHEAD_SECONDS = 0.8f;
+const int LOOKAHEAD_SAMPLES = 6;
+const float SAFETY_MARGIN = 10.0f;     // Extra clearance around the hitbox
+const float HOME_HEIGHT = 0.78f;       // Fraction of the field height to hang around at
+const float DANGER_WEIGHT = 10000.0f;  // Any predicted hit outweighs every goal distance
+const float ENEMY_DRIFT = 150.0f;      // Enemies also weave sideways (some home in): their reach grows by this (px/s)
+
+// Each direction is tried as a short sidestep, a longer move and a full move, then holding
+const int MOVE_DURATIONS = 3;
+const float MOVE_SECONDS[MOVE_DURATIONS] = {0.1f, 0.3f, LOOKAHEAD_SECONDS};
+
+Autopilot::Autopilot()
+    : m_fieldWidth(0.0f)
+    , m_fieldHeight(0.0f)
+{
+    m_threats.reserve(1024);
+}
+
+void Autopilot::setField(int width, int height) {
+    m_fieldWidth = static_cast<float>(width);
+    m_fieldHeight = static_cast<float>(height);
+}
+
+bool Autopilot::isHelpful(PowerUpType type) {
+    switch (type) {
+        case PowerUpType::SPEED_DOWN:
+        case PowerUpType::LASER_DOWN:
+        case PowerUpType::MISSILE_DOWN:
+        case PowerUpType::ENERGY_DOWN:
+            return false;
+        default:
+            return true;
+    }
+}
+
+Autopilot::Command Autopilot::update(const Player& player,
+                                     const std::vector<std::unique_ptr<Enemy>>& enemies,
+                                     const BulletPool& enemyBullets,
+                                     const Boss* boss,
+                                     const std::vector<ObjectPool<PowerUp>::Ptr>& powerUps,
+                                     const std::vector<ObjectPool<ItemBox>::Ptr>& itemBoxes) {
+    float centerX = player.getX() + player.getWidth() / 2;
+    float centerY = player.getY() + player.getHeight() / 2;
+    float speed = player.getSpeed();
+    float hitboxRadius = std::max(player.getHitboxWidth(), player.getHitboxHeight()) / 2 + SAFETY_MARGIN;
+    float halfWidth = player.getWidth() / 2;
+    float halfHeight = player.getHeight() / 2;
+
+    // Only what can reach the ship within the look-ahead
+    m_threats.clear();
+    auto addThreat = [&](float x, float y, float vx, float vy, float radius, float drift) {
+        float dx = x - centerX;
+        float dy = y - centerY;
+        float reach = radius + (speed + std::fabs(vx) + std::fabs(vy) + drift) * LOOKAHEAD_SECONDS;
+        if (dx * dx + dy * dy < reach * reach) {
+            m_threats.push_back({x, y, vx, vy, radius, drift});
+        }
+    };
+    for (const Bullet& bullet : enemyBullets) {
+        addThreat(bullet.getX() + bullet.getWidth() / 2, bullet.getY() + bullet.getHeight() / 2,
+                  bullet.getVelocityX(), bullet.getVelocityY(),
+                  std::max(bullet.getWidth(), bullet.getHeight()) / 2 + hitboxRadius, 0.0f);
+    }
+    for (const auto& enemy : enemies) {
+        addThreat(enemy->getHitboxX() + enemy->getHitboxWidth() / 2, enemy->getHitboxY() + enemy->getHitboxHeight() / 2,
+                  0.0f, enemy->getSpeed(),
+                  std::max(enemy->getHitboxWidth(), enemy->getHitboxHeight()) / 2 + hitboxRadius, ENEMY_DRIFT);
+    }
+    if (boss) {
+        addThreat(boss->getHitboxX() + boss->getHitboxWidth() / 2, boss->getHitboxY() + boss->getHitboxHeight() / 2,
+                  0.0f, 0.0f, std::max(boss->getHitboxWidth(), boss->getHitboxHeight()) / 2 + hitboxRadius, 0.0f);
+    }
+
+    // Goal: the closest pickup worth having, otherwise line up a shot
+    float goalX = m_fieldWidth / 2;
+    float goalY = m_fieldHeight * HOME_HEIGHT;
+    float bestPickup = -1.0f;
+    auto considerPickup = [&](float x, float y) {
+        float distance = (x - centerX) * (x - centerX) + (y - centerY) * (y - centerY);
+        if (y > 0.0f && (bestPickup < 0.0f || distance < bestPickup)) {
+            bestPickup = distance;
+            goalX = x;
+            goalY = y;
+        }
+    };
+    for (const auto& powerUp : powerUps) {
+        if (isHelpful(powerUp->getType())) {
+            considerPickup(powerUp->getX() + powerUp->getWidth() / 2, powerUp->getY() + powerUp->getHeight() / 2);
+        }
+    }
+    bool hiddenBoxes = false;
+    for (const auto& box : itemBoxes) {
+        if (box->isRevealed()) {
+            considerPickup(box->getX() + box->getWidth() / 2, box->getY() + box->getHeight() / 2);
+        } else {
+            hiddenBoxes = true;
+        }
+    }
+    if (bestPickup < 0.0f) {
+        if (boss) {
+            goalX = boss->getWeakPointX() + boss->getWeakPointWidth() / 2;
+        } else {
+            float bestGap = -1.0f;
+            for (const auto& enemy : enemies) {
+                float x = enemy->getX() + enemy->getWidth() / 2;
+                float gap = std::fabs(x - centerX);
+                if (enemy->getY() > 0.0f && enemy->getY() < centerY && (bestGap < 0.0f || gap < bestGap)) {
+                    bestGap = gap;
+                    goalX = x;
+                }
+            }
+        }
+    }
+
+    // Try each steering choice against the predicted threats
+    int bestChoice = 0;
+    float bestScore = -1.0f;
+    for (int plan = 0; plan < STEER_DIRECTIONS * MOVE_DURATIONS; plan++) {
+        int choice = plan % STEER_DIRECTIONS;
+        float moveSeconds = MOVE_SECONDS[plan / STEER_DIRECTIONS];
+        if (choice == 0 && plan != 0) {
+            continue;  // Holding is the same plan whatever the duration
+        }
+        float danger = 0.0f;
+        float x = centerX;
+        float y = centerY;
+        float previousT = 0.0f;
+        for (int sample = 1; sample <= LOOKAHEAD_SAMPLES; sample++) {
+            float t = LOOKAHEAD_SECONDS * sample / LOOKAHEAD_SAMPLES;
+            float previousX = x;
+            float previousY = y;
+            float moved = speed * std::min(t, moveSeconds);
+            x = std::min(std::max(centerX + STEER_X[choice] * moved, halfWidth), m_fieldWidth - halfWidth);
+            y = std::min(std::max(centerY + STEER_Y[choice] * moved, halfHeight), m_fieldHeight - halfHeight);
+            for (const Threat& threat : m_threats) {
+                // Closest approach over the step: fast bullets cover more than their radius per sample
+                float startX = threat.x + threat.vx * previousT - previousX;
+                float startY = threat.y + threat.vy * previousT - previousY;
+                float moveX = threat.x + threat.vx * t - x - startX;
+                float moveY = threat.y + threat.vy * t - y - startY;
+                float length = moveX * moveX + moveY * moveY;
+                float s = length > 0.0f ? std::min(std::max(-(startX * moveX + startY * moveY) / length, 0.0f), 1.0f) : 0.0f;
+                float dx = startX + moveX * s;
+                float dy = startY + moveY * s;
+                float radius = threat.radius + threat.drift * t;
+                if (dx * dx + dy * dy < radius * radius) {
+                    danger += 1.0f / sample;  // Sooner hits are worse
+                }
+            }
+            previousT = t;
+        }
+        float score = danger * DANGER_WEIGHT + std::sqrt((goalX - x) * (goalX - x) + (goalY - y) * (goalY - y));
+        if (bestScore < 0.0f || score < bestScore) {
+            bestScore = score;
+            bestChoice = choice;
+        }
+    }
+
+    Command command;
+    command.targetX = centerX + STEER_X[bestChoice] * STEER_DISTANCE;
+    command.targetY = centerY + STEER_Y[bestChoice] * STEER_DISTANCE;
+    command.fire = boss != nullptr || !enemies.empty() || hiddenBoxes;
+    return command;
+}
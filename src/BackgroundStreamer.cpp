@@ -0,0 +1,199 @@
+#include "BackgroundStreamer.h"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+
+BackgroundStreamer::BackgroundStreamer()
+    : m_renderer(nullptr)
+    , m_width(0)
+    , m_height(0)
+    , m_prescale(false)
+    , m_archive(nullptr)
+    , m_stopping(false)
+{
+    for (Slot& slot : m_slots) {
+        slot.state = SlotState::EVICTED;
+        slot.texture = nullptr;
+    }
+}
+
+BackgroundStreamer::~BackgroundStreamer() {
+    stop();
+}
+
+void BackgroundStreamer::setPath(SpriteId sprite, const std::string& path) {
+    m_slots[static_cast<int>(sprite)].path = path;
+}
+
+void BackgroundStreamer::start(SDL_Renderer* renderer, int width, int height) {
+    m_renderer = renderer;
+    m_width = width;
+    m_height = height;
+    m_prescale = SDL_RenderTargetSupported(renderer) == SDL_TRUE;
+    m_stopping = false;
+    m_worker = std::thread(&BackgroundStreamer::workerLoop, this);
+}
+
+void BackgroundStreamer::stop() {
+    if (m_worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        m_worker.join();
+    }
+
+    for (Decoded& decoded : m_decoded) {
+        if (decoded.surface) {
+            SDL_FreeSurface(decoded.surface);
+        }
+    }
+    m_decoded.clear();
+    m_requests.clear();
+    releaseTextures();
+}
+
+void BackgroundStreamer::retain(const SpriteId* sprites, int count) {
+    bool requested = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Evict everything not named this frame (pending decodes are dropped too)
+        for (int i = 0; i < static_cast<int>(SpriteId::COUNT); i++) {
+            Slot& slot = m_slots[i];
+            if (slot.state != SlotState::RESIDENT && slot.state != SlotState::LOADING) {
+                continue;
+            }
+            if (std::find(sprites, sprites + count, static_cast<SpriteId>(i)) != sprites + count) {
+                continue;
+            }
+            if (slot.texture) {
+                SDL_DestroyTexture(slot.texture);
+                slot.texture = nullptr;
+                SDL_Log("INFO: Evicted background: %s", slot.path.c_str());
+            }
+            slot.state = SlotState::EVICTED;
+            m_requests.erase(std::remove(m_requests.begin(), m_requests.end(), static_cast<SpriteId>(i)), m_requests.end());
+        }
+
+        // Queue decodes for wanted segments that are not resident
+        for (int i = 0; i < count; i++) {
+            Slot& slot = m_slots[static_cast<int>(sprites[i])];
+            if (slot.state == SlotState::EVICTED && !slot.path.empty()) {
+                slot.state = SlotState::LOADING;
+                m_requests.push_back(sprites[i]);
+                requested = true;
+            }
+        }
+    }
+    if (requested) {
+        m_wake.notify_one();
+    }
+
+    // Upload finished decodes; a segment evicted meanwhile just drops its surface
+    std::vector<Decoded> decoded;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        decoded.swap(m_decoded);
+    }
+    for (const Decoded& item : decoded) {
+        Slot& slot = m_slots[static_cast<int>(item.sprite)];
+        if (slot.state == SlotState::LOADING) {
+            slot.texture = item.surface ? upload(item.surface) : nullptr;
+            slot.state = slot.texture ? SlotState::RESIDENT : SlotState::MISSING;
+            if (slot.texture) {
+                SDL_Log("INFO: Streamed in background: %s", slot.path.c_str());
+            } else {
+                SDL_Log("INFO: Failed to load background: %s", slot.path.c_str());
+            }
+        }
+        if (item.surface) {
+            SDL_FreeSurface(item.surface);
+        }
+    }
+}
+
+SDL_Texture* BackgroundStreamer::getTexture(SpriteId sprite) const {
+    return m_slots[static_cast<int>(sprite)].texture;
+}
+
+bool BackgroundStreamer::isMissing(SpriteId sprite) const {
+    return m_slots[static_cast<int>(sprite)].state == SlotState::MISSING;
+}
+
+int BackgroundStreamer::getResidentCount() const {
+    int count = 0;
+    for (const Slot& slot : m_slots) {
+        if (slot.texture) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void BackgroundStreamer::releaseTextures() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Slot& slot : m_slots) {
+        if (slot.texture) {
+            SDL_DestroyTexture(slot.texture);
+            slot.texture = nullptr;
+        }
+        if (slot.state == SlotState::RESIDENT || slot.state == SlotState::LOADING) {
+            slot.state = SlotState::EVICTED;
+        }
+    }
+    m_requests.clear();
+}
+
+SDL_Texture* BackgroundStreamer::upload(SDL_Surface* surface) {
+    SDL_Texture* source = SDL_CreateTextureFromSurface(m_renderer, surface);
+    if (!source || !m_prescale) {
+        return source;
+    }
+
+    // Scale to the window once so drawing it is an unfiltered 1:1 copy
+    SDL_Texture* scaled = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, m_width, m_height);
+    if (!scaled) {
+        SDL_Log("WARNING: Failed to pre-scale background: %s", SDL_GetError());
+        SDL_DestroyTexture(source);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(scaled, SDL_BLENDMODE_NONE);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(m_renderer);
+    SDL_SetRenderTarget(m_renderer, scaled);
+    SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+    SDL_RenderClear(m_renderer);
+    SDL_RenderCopy(m_renderer, source, nullptr, nullptr);
+    SDL_SetRenderTarget(m_renderer, previousTarget);
+
+    SDL_DestroyTexture(source);
+    return scaled;
+}
+
+void BackgroundStreamer::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+        if (m_stopping) {
+            return;
+        }
+
+        SpriteId sprite = m_requests.front();
+        m_requests.erase(m_requests.begin());
+        std::string path = m_slots[static_cast<int>(sprite)].path;
+
+        // Decode without holding the lock (archive images are already decoded)
+        lock.unlock();
+        SDL_Surface* surface = m_archive ? m_archive->createSurface(path) : nullptr;
+        if (!surface) {
+            surface = IMG_Load(path.c_str());
+        }
+        if (!surface) {
+            SDL_Log("INFO: Failed to decode %s: %s", path.c_str(), IMG_GetError());
+        }
+        lock.lock();
+
+        m_decoded.push_back({sprite, surface});
+    }
+}
@@ -0,0 +1,202 @@
+#include "BalanceSimulator.h"
+#include "Game.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+
+const float STEP_SECONDS = 1.0f / 60.0f;  // Same tick as the simulation thread
+
+// CSV / --tune names of GameTuning::dropWeights, in DropCategory order
+const char* const DROP_SETTING_NAMES[static_cast<int>(DropCategory::COUNT)] = {
+    "drop_speed", "drop_laser", "drop_missile", "drop_energy", "drop_bonus",
+    "drop_one_up", "drop_voltage", "drop_keep", "drop_penalty"
+};
+
+// Nearest-rank percentile of sorted values
+template <typename T>
+static float percentile(const std::vector<T>& sorted, float fraction) {
+    if (sorted.empty()) {
+        return 0.0f;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return static_cast<float>(sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1]);
+}
+
+BalanceSimulator::BalanceSimulator(const Options& options)
+    : m_options(options)
+    , m_jobs(JobSystem::workerCountFor(options.threadCount))
+{
+    // Games run their entity updates inline; the sessions are what is spread over the cores
+    for (unsigned i = 0; i < m_jobs.getThreadCount(); i++) {
+        m_games.push_back(std::make_unique<Game>(0u));
+        m_games.back()->initHeadless(Game::FIELD_WIDTH, Game::FIELD_HEIGHT, options.seed);
+        m_games.back()->setAutopilot(true);
+    }
+    SDL_Log("INFO: Balance simulator: %d sessions per tuning on %u threads", options.sessions, m_jobs.getThreadCount());
+}
+
+BalanceSimulator::~BalanceSimulator() = default;
+
+BalanceSimulator::SessionResult BalanceSimulator::playSession(Game& game, const GameTuning& tuning, uint64_t seed) const {
+    game.setTuning(tuning);
+    game.startSession(seed);
+
+    long long maxTicks = static_cast<long long>(m_options.maxSessionSeconds / STEP_SECONDS);
+    long long tick = 0;
+    for (; tick < maxTicks && !game.isGameOver(); tick++) {
+        game.update(STEP_SECONDS);
+    }
+
+    const Game::SessionStats& stats = game.getSessionStats();
+    SessionResult result;
+    result.survivalSeconds = stats.playTime;
+    result.score = game.getScore();
+    result.kills = stats.kills;
+    result.killsToFirstBoss = stats.killsToFirstBoss;
+    result.timeToFirstBoss = stats.timeToFirstBoss;
+    result.bossesDefeated = stats.bossesDefeated;
+    result.stage = game.getStage();
+    result.speedLevel = stats.maxSpeedLevel;
+    result.laserLevel = stats.maxLaserLevel;
+    result.missileLevel = stats.maxMissileLevel;
+    result.pickups = stats.pickups;
+    result.truncated = !game.isGameOver();
+    return result;
+}
+
+void BalanceSimulator::run(const GameTuning& tuning, const std::string& label) {
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+
+    // One session per job; stealing keeps every core busy while session lengths vary.
+    // Per-event game logs from every session would bury the report; warnings still show
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN);
+    m_results.resize(m_options.sessions);
+    m_jobs.parallelFor(m_results.size(), 1, [&](size_t begin, size_t end, unsigned thread) {
+        for (size_t i = begin; i < end; i++) {
+            m_results[i] = playSession(*m_games[thread], tuning, m_options.seed + i);
+        }
+    });
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    Summary summary = summarize(m_results);
+    summary.label = label;
+    summary.tuning = tuning;
+    summary.wallSeconds = std::chrono::duration<float>(Clock::now() - start).count();
+    m_summaries.push_back(summary);
+
+    SDL_Log("INFO: Balance [%s]: %d sessions in %.1fs, survival %.0fs, score p50 %.0f, boss reached %.0f%%, max stage %d",
+            label.c_str(), summary.sessions, summary.wallSeconds, summary.survivalMean, summary.scoreP50,
+            summary.bossReachedPercent, summary.maxStage);
+}
+
+BalanceSimulator::Summary BalanceSimulator::summarize(const std::vector<SessionResult>& results) {
+    Summary summary = Summary();
+    summary.sessions = static_cast<int>(results.size());
+    if (results.empty()) {
+        return summary;
+    }
+
+    std::vector<float> survival;
+    std::vector<int> scores;
+    survival.reserve(results.size());
+    scores.reserve(results.size());
+    int bossReached = 0;
+    for (const SessionResult& result : results) {
+        survival.push_back(result.survivalSeconds);
+        scores.push_back(result.score);
+        summary.survivalMean += result.survivalSeconds;
+        summary.scoreMean += result.score;
+        summary.killsMean += result.kills;
+        summary.bossesDefeatedMean += result.bossesDefeated;
+        summary.speedLevelMean += result.speedLevel;
+        summary.laserLevelMean += result.laserLevel;
+        summary.missileLevelMean += result.missileLevel;
+        summary.pickupsMean += result.pickups;
+        summary.maxStage = std::max(summary.maxStage, result.stage);
+        summary.truncated += result.truncated ? 1 : 0;
+        if (result.killsToFirstBoss >= 0) {
+            bossReached++;
+            summary.killsToBossMean += result.killsToFirstBoss;
+            summary.timeToBossMean += result.timeToFirstBoss;
+        }
+    }
+    std::sort(survival.begin(), survival.end());
+    std::sort(scores.begin(), scores.end());
+
+    float count = static_cast<float>(results.size());
+    summary.survivalMean /= count;
+    summary.survivalP50 = percentile(survival, 0.5f);
+    summary.scoreMean /= count;
+    summary.scoreP10 = percentile(scores, 0.1f);
+    summary.scoreP50 = percentile(scores, 0.5f);
+    summary.scoreP90 = percentile(scores, 0.9f);
+    summary.killsMean /= count;
+    summary.bossReachedPercent = 100.0f * bossReached / count;
+    if (bossReached > 0) {
+        summary.killsToBossMean /= bossReached;
+        summary.timeToBossMean /= bossReached;
+    }
+    summary.bossesDefeatedMean /= count;
+    summary.speedLevelMean /= count;
+    summary.laserLevelMean /= count;
+    summary.missileLevelMean /= count;
+    summary.pickupsMean /= count;
+    return summary;
+}
+
+bool BalanceSimulator::writeCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        SDL_Log("WARNING: Could not write balance report %s", path.c_str());
+        return false;
+    }
+
+    file << "label";
+    for (const char* name : DROP_SETTING_NAMES) {
+        file << ',' << name;
+    }
+    file << ",enemy_cooldown,boss_health,boss_damage,weak_point_damage"
+         << ",sessions,survival_mean,survival_p50,score_mean,score_p10,score_p50,score_p90,kills_mean"
+         << ",boss_reached_pct,kills_to_boss_mean,time_to_boss_mean,bosses_defeated_mean,max_stage"
+         << ",speed_level_mean,laser_level_mean,missile_level_mean,pickups_mean,truncated,wall_seconds\n";
+
+    for (const Summary& row : m_summaries) {
+        file << '"' << row.label << '"';
+        for (int weight : row.tuning.dropWeights) {
+            file << ',' << weight;
+        }
+        file << ',' << row.tuning.enemyCooldownScale << ',' << row.tuning.bossHealthScale
+             << ',' << row.tuning.bossHitDamage << ',' << row.tuning.weakPointDamage
+             << ',' << row.sessions << ',' << row.survivalMean << ',' << row.survivalP50
+             << ',' << row.scoreMean << ',' << row.scoreP10 << ',' << row.scoreP50 << ',' << row.scoreP90
+             << ',' << row.killsMean << ',' << row.bossReachedPercent << ',' << row.killsToBossMean
+             << ',' << row.timeToBossMean << ',' << row.bossesDefeatedMean << ',' << row.maxStage
+             << ',' << row.speedLevelMean << ',' << row.laserLevelMean << ',' << row.missileLevelMean
+             << ',' << row.pickupsMean << ',' << row.truncated << ',' << row.wallSeconds << '\n';
+    }
+    return true;
+}
+
+bool BalanceSimulator::applySetting(GameTuning& tuning, const std::string& name, float value) {
+    for (int i = 0; i < static_cast<int>(DropCategory::COUNT); i++) {
+        if (name == DROP_SETTING_NAMES[i]) {
+            tuning.dropWeights[i] = static_cast<int>(value);
+            return true;
+        }
+    }
+    if (name == "enemy_cooldown") {
+        tuning.enemyCooldownScale = value;
+    } else if (name == "boss_health") {
+        tuning.bossHealthScale = value;
+    } else if (name == "boss_damage") {
+        tuning.bossHitDamage = static_cast<int>(value);
+    } else if (name == "weak_point_damage") {
+        tuning.weakPointDamage = static_cast<int>(value);
+    } else {
+        return false;
+    }
+    return true;
+}
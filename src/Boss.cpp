@@ -1,4 +1,5 @@
 #include "Boss.h"
+#include "FastMath.h"
 #include <cmath>
 
 Boss::Boss(float x, float y, int stage)
@@ -12,8 +13,6 @@ Boss::Boss(float x, float y, int stage)
     , m_maxHealth(100)
     , m_state(BossState::ENTERING)
     , m_movementTimer(0.0f)
-    , m_shootTimer(2.0f)
-    , m_shootCooldown(2.0f)
     , m_targetY(100.0f)
     , m_deathTimer(0.0f)
 {
@@ -40,9 +39,6 @@ Boss::Boss(float x, float y, int stage)
     m_cannonPositions[11] = {190.0f, 190.0f}; // Bottom-right
 }
 
-Boss::~Boss() {
-}
-
 void Boss::update(float deltaTime) {
     m_movementTimer += deltaTime;
     
@@ -59,12 +55,7 @@ void Boss::update(float deltaTime) {
             
         case BossState::FIGHTING:
             // Horizontal movement pattern (sine wave)
-            m_x += 80.0f * sin(m_movementTimer * 1.5f) * deltaTime;
-            
-            // Update shoot timer
-            if (m_shootTimer > 0.0f) {
-                m_shootTimer -= deltaTime;
-            }
+            m_x += 80.0f * FastMath::sin(m_movementTimer * 1.5f) * deltaTime;
             break;
             
         case BossState::DYING:
@@ -80,48 +71,20 @@ void Boss::update(float deltaTime) {
     }
 }
 
-void Boss::render(SDL_Renderer* renderer) {
-    // Draw boss as large red rectangle
-    if (m_state == BossState::DYING) {
-        // Flash during death
-        Uint8 alpha = static_cast<Uint8>(128 + 127 * sin(m_deathTimer * 20));
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, alpha);
-    } else {
-        SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
-    }
-    
+void Boss::draw(std::vector<SpriteDraw>& out, SpriteId sprite) const {
     SDL_Rect rect = {
         static_cast<int>(m_x),
         static_cast<int>(m_y),
         static_cast<int>(m_width),
         static_cast<int>(m_height)
     };
-    SDL_RenderFillRect(renderer, &rect);
-}
-
-void Boss::render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect) {
-    if (texture) {
-        SDL_Rect dstRect = {
-            static_cast<int>(m_x),
-            static_cast<int>(m_y),
-            static_cast<int>(m_width),
-            static_cast<int>(m_height)
-        };
-        
+    
+    if (m_state == BossState::DYING) {
         // Flash during death
-        if (m_state == BossState::DYING) {
-            Uint8 alpha = static_cast<Uint8>(128 + 127 * sin(m_deathTimer * 20));
-            SDL_SetTextureAlphaMod(texture, alpha);
-        }
-        
-        SDL_RenderCopy(renderer, texture, srcRect, &dstRect);
-        
-        // Reset alpha
-        if (m_state == BossState::DYING) {
-            SDL_SetTextureAlphaMod(texture, 255);
-        }
+        Uint8 alpha = static_cast<Uint8>(128 + 127 * sin(m_deathTimer * 20));
+        out.push_back({rect, sprite, alpha, {255, 0, 0, alpha}, false});
     } else {
-        render(renderer);
+        out.push_back({rect, sprite, 255, {200, 0, 0, 255}, false});
     }
 }
 
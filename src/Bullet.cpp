@@ -1,4 +1,9 @@
 #include "Bullet.h"
+#include <algorithm>
+#include <cmath>
+
+const float HOMING_TURN_RATE = 8.0f;  // rad/s: about a 100 px turning radius at full speed
+const float PI = 3.14159265f;
 
 Bullet::Bullet(float x, float y, Owner owner, BulletType type)
     : m_x(x)
@@ -8,12 +13,34 @@ Bullet::Bullet(float x, float y, Owner owner, BulletType type)
     , m_speed(type == BulletType::MISSILE ? 800.0f : 500.0f)  // Max speed for missile
     , m_acceleration(type == BulletType::MISSILE ? 1200.0f : 0.0f)  // Missile acceleration
     , m_currentSpeed(type == BulletType::MISSILE ? 100.0f : 500.0f)  // Start slow for missile
+    , m_vx(0.0f)
+    , m_vy(owner == Owner::PLAYER ? -m_speed : m_speed)  // Player bullets move upward, enemy bullets downward
     , m_owner(owner)
     , m_type(type)
+    , m_homing(false)
+    , m_hasTarget(false)
+    , m_targetX(0.0f)
+    , m_targetY(0.0f)
 {
 }
 
-Bullet::~Bullet() {
+Bullet::Bullet(float x, float y, float velocityX, float velocityY, Owner owner)
+    : m_x(x)
+    , m_y(y)
+    , m_width(8.0f)   // Round-ish pellet so diagonal shots read correctly
+    , m_height(8.0f)
+    , m_speed(0.0f)
+    , m_acceleration(0.0f)
+    , m_currentSpeed(0.0f)
+    , m_vx(velocityX)
+    , m_vy(velocityY)
+    , m_owner(owner)
+    , m_type(BulletType::LASER)
+    , m_homing(false)
+    , m_hasTarget(false)
+    , m_targetX(0.0f)
+    , m_targetY(0.0f)
+{
 }
 
 void Bullet::update(float deltaTime) {
@@ -23,42 +50,32 @@ void Bullet::update(float deltaTime) {
         if (m_currentSpeed > m_speed) {
             m_currentSpeed = m_speed;  // Cap at max speed
         }
-    }
-    
-    float moveSpeed = (m_type == BulletType::MISSILE && m_owner == Owner::PLAYER) ? m_currentSpeed : m_speed;
-    
-    if (m_owner == Owner::PLAYER) {
-        // Player bullets move upward
-        m_y -= moveSpeed * deltaTime;
-    } else {
-        // Enemy bullets move downward
-        m_y += moveSpeed * deltaTime;
-    }
-}
-
-void Bullet::render(SDL_Renderer* renderer) {
-    if (m_owner == Owner::PLAYER) {
-        if (m_type == BulletType::MISSILE) {
-            // Missiles are red and thicker
-            SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
+        if (m_homing) {
+            float heading = std::atan2(m_vy, m_vx);
+            if (m_hasTarget) {
+                float turn = std::atan2(m_targetY - (m_y + m_height / 2), m_targetX - (m_x + m_width / 2)) - heading;
+                if (turn > PI) turn -= 2 * PI;
+                if (turn < -PI) turn += 2 * PI;
+                float maxTurn = HOMING_TURN_RATE * deltaTime;
+                heading += std::min(std::max(turn, -maxTurn), maxTurn);
+            }
+            m_vx = std::cos(heading) * m_currentSpeed;
+            m_vy = std::sin(heading) * m_currentSpeed;
         } else {
-            // Lasers are yellow
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+            m_vy = -m_currentSpeed;
         }
-    } else {
-        // Enemy bullets are orange
-        SDL_SetRenderDrawColor(renderer, 255, 150, 0, 255);
     }
-
-    SDL_Rect rect = {
-        static_cast<int>(m_x),
-        static_cast<int>(m_y),
-        static_cast<int>(m_width),
-        static_cast<int>(m_height)
-    };
-    SDL_RenderFillRect(renderer, &rect);
+    
+    m_x += m_vx * deltaTime;
+    m_y += m_vy * deltaTime;
 }
 
+
 bool Bullet::isOffScreen(int windowHeight) const {
     return m_y < -20 || m_y > windowHeight + 20; // Remove when it goes off screen top or bottom
 }
+
+bool Bullet::isOffScreen(int windowWidth, int windowHeight) const {
+    // Pattern bullets can leave through the sides as well
+    return isOffScreen(windowHeight) || m_x < -20 || m_x > windowWidth + 20;
+}
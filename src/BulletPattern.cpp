@@ -0,0 +1,209 @@
+#include "BulletPattern.h"
+#include <cmath>
+
+namespace {
+
+const float DEG_TO_RAD = 3.14159265f / 180.0f;
+
+// Cannon groups (see Boss constructor for the layout)
+const uint16_t CANNONS_TOP = 0x000F;     // 0-3
+const uint16_t CANNONS_MIDDLE = 0x00F0;  // 4-7
+const uint16_t CANNONS_BOTTOM = 0x0F00;  // 8-11
+const uint16_t CANNONS_INNER = 0x0666;   // Center two of each row
+const uint16_t CANNONS_OUTER = 0x0999;   // Outer two of each row
+
+//                          type                  cnt  speed  spread  spin  volleys interval pause
+// Stage 1: classic straight volley plus aimed shots from the bottom row
+const PatternStep STAGE1_MAIN[] = {
+    {PatternType::STRAIGHT, 1, 500.0f,   0.0f,  0.0f, 1, 0.0f, 2.0f},
+};
+const PatternStep STAGE1_AIMED[] = {
+    {PatternType::AIMED,    1, 250.0f,   0.0f,  0.0f, 3, 0.3f, 1.5f},
+};
+const PatternTrack STAGE1_TRACKS[] = {
+    {CANNONS_TOP | CANNONS_MIDDLE, 2.0f, STAGE1_MAIN, 1},
+    {CANNONS_BOTTOM & CANNONS_INNER, 3.0f, STAGE1_AIMED, 1},
+};
+
+// Stage 2: fans from the bottom row, rings from the middle
+const PatternStep STAGE2_FAN[] = {
+    {PatternType::FAN,      5, 220.0f,  60.0f,  0.0f, 2, 0.4f, 1.2f},
+    {PatternType::AIMED,    3, 280.0f,  20.0f,  0.0f, 2, 0.3f, 1.0f},
+};
+const PatternStep STAGE2_RING[] = {
+    {PatternType::RING,    12, 150.0f,   0.0f,  0.0f, 1, 0.0f, 2.5f},
+};
+const PatternTrack STAGE2_TRACKS[] = {
+    {CANNONS_BOTTOM & CANNONS_INNER, 2.0f, STAGE2_FAN, 2},
+    {CANNONS_MIDDLE & CANNONS_INNER, 3.0f, STAGE2_RING, 1},
+};
+
+// Stage 3: twin spirals with aimed bursts
+const PatternStep STAGE3_SPIRAL[] = {
+    {PatternType::SPIRAL,   4, 180.0f,   0.0f, 13.0f, 40, 0.1f, 2.0f},
+};
+const PatternStep STAGE3_AIMED[] = {
+    {PatternType::AIMED,    5, 300.0f,  30.0f,  0.0f, 3, 0.25f, 1.5f},
+    {PatternType::FAN,      9, 200.0f, 120.0f,  0.0f, 1, 0.0f, 1.5f},
+};
+const PatternTrack STAGE3_TRACKS[] = {
+    {CANNONS_MIDDLE & CANNONS_INNER, 2.0f, STAGE3_SPIRAL, 1},
+    {CANNONS_OUTER & CANNONS_BOTTOM, 3.0f, STAGE3_AIMED, 2},
+};
+
+// Stage 4: dense mix of everything
+const PatternStep STAGE4_SPIRAL[] = {
+    {PatternType::SPIRAL,   6, 170.0f,   0.0f, -9.0f, 60, 0.08f, 1.0f},
+};
+const PatternStep STAGE4_RING[] = {
+    {PatternType::RING,    16, 130.0f,   0.0f,  0.0f, 3, 0.6f, 2.0f},
+};
+const PatternStep STAGE4_FAN[] = {
+    {PatternType::FAN,      7, 240.0f,  90.0f,  0.0f, 3, 0.35f, 0.8f},
+    {PatternType::AIMED,    3, 320.0f,  15.0f,  0.0f, 4, 0.2f, 1.2f},
+};
+const PatternTrack STAGE4_TRACKS[] = {
+    {CANNONS_MIDDLE & CANNONS_INNER, 2.0f, STAGE4_SPIRAL, 1},
+    {CANNONS_TOP & CANNONS_OUTER, 3.0f, STAGE4_RING, 1},
+    {CANNONS_BOTTOM, 2.5f, STAGE4_FAN, 2},
+};
+
+const BossScript BOSS_SCRIPTS[] = {
+    {STAGE1_TRACKS, 2},
+    {STAGE2_TRACKS, 2},
+    {STAGE3_TRACKS, 2},
+    {STAGE4_TRACKS, 3},
+};
+
+} // namespace
+
+const BossScript& getBossScript(int stage) {
+    int index = (stage < 1) ? 0 : (stage - 1) % 4;
+    return BOSS_SCRIPTS[index];
+}
+
+BulletPatternEngine::BulletPatternEngine()
+    : m_script(nullptr)
+{
+}
+
+void BulletPatternEngine::start(const BossScript& script) {
+    m_script = &script;
+    for (int i = 0; i < MAX_TRACKS; i++) {
+        m_tracks[i].step = 0;
+        m_tracks[i].volley = 0;
+        m_tracks[i].timer = (i < script.trackCount) ? script.tracks[i].startDelay : 0.0f;
+        m_tracks[i].angle = 0.0f;
+    }
+}
+
+void BulletPatternEngine::saveState(StateWriter& writer) const {
+    int32_t scriptIndex = m_script ? static_cast<int32_t>(m_script - BOSS_SCRIPTS) : -1;
+    writer.write(scriptIndex);
+    writer.write(m_tracks);
+}
+
+bool BulletPatternEngine::loadState(StateReader& reader) {
+    int32_t scriptIndex = -1;
+    if (!reader.read(scriptIndex) || !reader.read(m_tracks)) {
+        return false;
+    }
+    int scriptCount = static_cast<int>(sizeof(BOSS_SCRIPTS) / sizeof(BOSS_SCRIPTS[0]));
+    m_script = (scriptIndex >= 0 && scriptIndex < scriptCount) ? &BOSS_SCRIPTS[scriptIndex] : nullptr;
+    return true;
+}
+
+void BulletPatternEngine::update(float deltaTime, const Boss& boss, float targetX, float targetY, BulletPool& bullets) {
+    if (!m_script) {
+        return;
+    }
+    
+    int trackCount = m_script->trackCount < MAX_TRACKS ? m_script->trackCount : MAX_TRACKS;
+    for (int t = 0; t < trackCount; t++) {
+        const PatternTrack& track = m_script->tracks[t];
+        TrackState& state = m_tracks[t];
+        if (track.stepCount <= 0) {
+            continue;
+        }
+        
+        state.timer -= deltaTime;
+        
+        // Catch up on every volley that became due this frame (long frames still fire in order)
+        while (state.timer <= 0.0f) {
+            const PatternStep& step = track.steps[state.step];
+            fireVolley(step, state, track.cannonMask, boss, targetX, targetY, bullets);
+            
+            state.volley++;
+            if (state.volley < step.volleys) {
+                state.timer += step.interval;
+            } else {
+                // Step done: wait, then move to the next step (looping)
+                state.timer += step.pause;
+                state.volley = 0;
+                state.step = (state.step + 1) % track.stepCount;
+            }
+            
+            // Guard against zero-length scripts spinning forever
+            if (step.interval <= 0.0f && step.pause <= 0.0f) {
+                state.timer = 0.1f;
+            }
+        }
+    }
+}
+
+void BulletPatternEngine::fireVolley(const PatternStep& step, TrackState& state, uint16_t cannonMask,
+                                     const Boss& boss, float targetX, float targetY, BulletPool& bullets) {
+    const Boss::CannonPos* cannons = boss.getCannonPositions();
+    int cannonCount = boss.getCannonCount();
+    int count = step.count > 0 ? step.count : 1;
+    
+    // Spiral rotation advances once per volley for all cannons of the track
+    float spin = 0.0f;
+    if (step.type == PatternType::SPIRAL) {
+        spin = state.angle;
+        state.angle = std::fmod(state.angle + step.spinDegrees, 360.0f);
+    }
+    
+    for (int i = 0; i < cannonCount; i++) {
+        if (!(cannonMask & (1u << i))) {
+            continue;
+        }
+        
+        float cannonX = boss.getX() + cannons[i].offsetX;
+        float cannonY = boss.getY() + cannons[i].offsetY;
+        
+        // Base direction and angular step between bullets of this volley
+        float baseAngle = 90.0f;
+        float angleStep = 0.0f;
+        switch (step.type) {
+            case PatternType::STRAIGHT:
+                baseAngle = 90.0f;
+                break;
+            case PatternType::AIMED: {
+                float aim = std::atan2(targetY - cannonY, targetX - cannonX) / DEG_TO_RAD;
+                angleStep = (count > 1) ? step.spreadDegrees / (count - 1) : 0.0f;
+                baseAngle = aim - step.spreadDegrees * 0.5f * (count > 1 ? 1.0f : 0.0f);
+                break;
+            }
+            case PatternType::RING:
+                baseAngle = 90.0f;
+                angleStep = 360.0f / count;
+                break;
+            case PatternType::SPIRAL:
+                baseAngle = 90.0f + spin;
+                angleStep = 360.0f / count;
+                break;
+            case PatternType::FAN:
+                angleStep = (count > 1) ? step.spreadDegrees / (count - 1) : 0.0f;
+                baseAngle = 90.0f - step.spreadDegrees * 0.5f * (count > 1 ? 1.0f : 0.0f);
+                break;
+        }
+        
+        for (int b = 0; b < count; b++) {
+            float angle = (baseAngle + angleStep * b) * DEG_TO_RAD;
+            if (!bullets.spawn(cannonX, cannonY, std::cos(angle) * step.speed, std::sin(angle) * step.speed, Bullet::Owner::ENEMY)) {
+                return;  // Pool full
+            }
+        }
+    }
+}
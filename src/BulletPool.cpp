@@ -0,0 +1,92 @@
+#include "BulletPool.h"
+
+BulletPool::BulletPool(size_t capacity)
+    : m_capacity(capacity)
+    , m_overflowLogged(false)
+{
+    m_bullets.reserve(capacity);
+}
+
+BulletPool::~BulletPool() {
+}
+
+Bullet* BulletPool::spawn(float x, float y, Bullet::Owner owner, Bullet::BulletType type) {
+    if (m_bullets.size() >= m_capacity) {
+        if (!m_overflowLogged) {
+            SDL_Log("WARNING: Bullet pool full (%zu), dropping shots", m_capacity);
+            m_overflowLogged = true;
+        }
+        return nullptr;
+    }
+    m_bullets.emplace_back(x, y, owner, type);
+    return &m_bullets.back();
+}
+
+Bullet* BulletPool::spawn(float x, float y, float velocityX, float velocityY, Bullet::Owner owner) {
+    if (m_bullets.size() >= m_capacity) {
+        if (!m_overflowLogged) {
+            SDL_Log("WARNING: Bullet pool full (%zu), dropping shots", m_capacity);
+            m_overflowLogged = true;
+        }
+        return nullptr;
+    }
+    m_bullets.emplace_back(x, y, velocityX, velocityY, owner);
+    return &m_bullets.back();
+}
+
+void BulletPool::update(float deltaTime) {
+    for (auto& bullet : m_bullets) {
+        bullet.update(deltaTime);
+    }
+}
+
+void BulletPool::removeOffScreen(int windowWidth, int windowHeight) {
+    for (size_t i = 0; i < m_bullets.size();) {
+        if (m_bullets[i].isOffScreen(windowWidth, windowHeight)) {
+            release(i);  // Re-check index i, it now holds the former last bullet
+        } else {
+            ++i;
+        }
+    }
+}
+
+void BulletPool::release(size_t index) {
+    if (index + 1 != m_bullets.size()) {
+        m_bullets[index] = m_bullets.back();
+    }
+    m_bullets.pop_back();
+}
+
+void BulletPool::saveState(StateWriter& writer) const {
+    writer.write(static_cast<uint32_t>(m_bullets.size()));
+    writer.writeBytes(m_bullets.data(), m_bullets.size() * sizeof(Bullet));
+}
+
+bool BulletPool::loadState(StateReader& reader) {
+    uint32_t count = 0;
+    if (!reader.read(count) || count > m_capacity) {
+        return false;
+    }
+    m_bullets.clear();
+    alignas(Bullet) unsigned char storage[sizeof(Bullet)];
+    for (uint32_t i = 0; i < count; i++) {
+        const Bullet* bullet = reader.readObject<Bullet>(storage);
+        if (!bullet) {
+            return false;
+        }
+        m_bullets.push_back(*bullet);
+    }
+    return true;
+}
+
+void BulletPool::draw(std::vector<SDL_Rect>& out) const {
+    for (const auto& bullet : m_bullets) {
+        out.push_back({
+            static_cast<int>(bullet.getX()),
+            static_cast<int>(bullet.getY()),
+            static_cast<int>(bullet.getWidth()),
+            static_cast<int>(bullet.getHeight())
+        });
+    }
+}
+
@@ -1,54 +1,26 @@
 #include "Enemy.h"
-#include <cmath>
+#include "EnemyArchetype.h"
 
 Enemy::Enemy(float x, float y, EnemyType type, bool isSpecial)
     : m_x(x)
     , m_y(y)
     , m_width(60.0f)
     , m_height(60.0f)
+    , m_speed(getArchetype(type).speed)
     , m_type(type)
     , m_isSpecial(isSpecial)
     , m_blinkTimer(0.0f)
+    , m_horizontalSpeed(getArchetype(type).horizontalSpeed)
     , m_movementTimer(0.0f)
-    , m_burstCount(0)
+    , m_shootTimer(getArchetype(type).shootCooldown)  // Initial delay
+    , m_shootCooldown(getArchetype(type).shootCooldown)
+    , m_burstCount(getArchetype(type).burstCount)
 {
-    // Set parameters based on enemy type
-    switch (m_type) {
-        case EnemyType::TYPE_01:
-            m_speed = 100.0f;  // Slow
-            m_horizontalSpeed = 30.0f;  // Slight movement toward player
-            m_shootCooldown = 1.5f + (rand() % 1);  // 1.5-2.5 seconds (3x faster)
-            break;
-        case EnemyType::TYPE_02:
-            m_speed = 150.0f;  // Normal
-            m_horizontalSpeed = 150.0f;  // Large zigzag (3x)
-            m_shootCooldown = 1.0f + (rand() % 1);  // 1-2 seconds (3x faster)
-            break;
-        case EnemyType::TYPE_03:
-            m_speed = 120.0f;  // Slow-normal
-            m_horizontalSpeed = 90.0f;  // Larger zigzag (3x)
-            m_shootCooldown = 999.0f;  // No shooting (special item enemy)
-            break;
-        case EnemyType::TYPE_04:
-            m_speed = 200.0f;  // Fast
-            m_horizontalSpeed = 50.0f;  // Some movement toward player
-            m_shootCooldown = 0.7f + (rand() % 1);  // 0.7-1.7 seconds (3x faster)
-            break;
-        case EnemyType::TYPE_05:
-            m_speed = 130.0f;  // Normal
-            m_horizontalSpeed = 210.0f;  // Very wide zigzag (3x)
-            m_shootCooldown = 1.3f;  // 1.3 seconds between bursts (3x faster)
-            m_burstCount = 3;  // 3 bullets per burst
-            break;
-    }
-    
-    m_shootTimer = m_shootCooldown;  // Initial delay
-}
-
-Enemy::~Enemy() {
 }
 
 void Enemy::update(float deltaTime, float playerX) {
+    const EnemyArchetype& archetype = getArchetype(m_type);
+    
     // Move downward
     m_y += m_speed * deltaTime;
     
@@ -56,80 +28,121 @@ void Enemy::update(float deltaTime, float playerX) {
     m_movementTimer += deltaTime;
     
     // Apply horizontal movement based on type
-    switch (m_type) {
-        case EnemyType::TYPE_01:
-            // Slow movement toward player
-            if (playerX >= 0.0f) {
-                float directionToPlayer = (playerX > m_x) ? 1.0f : -1.0f;
-                m_x += m_horizontalSpeed * directionToPlayer * deltaTime;
-            }
-            break;
-        case EnemyType::TYPE_02:
-            // Large zigzag movement
-            m_x += m_horizontalSpeed * sin(m_movementTimer * 3.0f) * deltaTime;
-            break;
-        case EnemyType::TYPE_03:
-            // Larger zigzag for special enemy
-            m_x += m_horizontalSpeed * sin(m_movementTimer * 2.0f) * deltaTime;
-            break;
-        case EnemyType::TYPE_04:
-            // Fast movement toward player
-            if (playerX >= 0.0f) {
-                float directionToPlayer = (playerX > m_x) ? 1.0f : -1.0f;
-                m_x += m_horizontalSpeed * directionToPlayer * deltaTime;
-            }
-            break;
-        case EnemyType::TYPE_05:
-            // Very wide zigzag movement
-            m_x += m_horizontalSpeed * sin(m_movementTimer * 2.5f) * deltaTime;
-            break;
-    }
+    m_x = archetype.move(m_x, m_movementTimer, m_horizontalSpeed, archetype.frequency, deltaTime, playerX);
     
-    if (m_isSpecial) {
-        m_blinkTimer += deltaTime;
-    }
+    m_blinkTimer += deltaTime;
     
+    updateShootTimer(deltaTime, archetype.burstCount);
+}
+
+void Enemy::updateShootTimer(float deltaTime, int burstCount) {
     // Update shoot timer
     if (m_shootTimer > 0.0f) {
         m_shootTimer -= deltaTime;
     }
     
-    // Reset burst count for TYPE_05 when cooldown finishes
-    if (m_type == EnemyType::TYPE_05 && m_shootTimer <= 0.0f && m_burstCount == 0) {
-        m_burstCount = 3;
-        m_shootCooldown = 1.3f;  // 1.3 seconds between bursts (3x faster)
+    // Refill burst when cooldown finishes (burst types only)
+    if (burstCount > 0 && m_shootTimer <= 0.0f && m_burstCount == 0) {
+        m_burstCount = burstCount;
     }
 }
 
-void Enemy::render(SDL_Renderer* renderer) {
-    // Draw enemy as red rectangle
-    SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
+template <typename Movement>
+void Enemy::updateBatchWith(std::unique_ptr<Enemy>* first, std::unique_ptr<Enemy>* last, float deltaTime, float playerX) {
+    // Per-type constants, loaded once for the whole batch
+    const EnemyArchetype& archetype = getArchetype((*first)->m_type);
+    const float speed = archetype.speed;
+    const float horizontalSpeed = archetype.horizontalSpeed;
+    const float frequency = archetype.frequency;
+    const int burstCount = archetype.burstCount;
+    
+    // Enemies are heap objects, so gather x/timer into packed arrays per chunk,
+    // run the movement step over the arrays (vectorizable), then scatter back
+    const int CHUNK_SIZE = 64;
+    float xs[CHUNK_SIZE];
+    float timers[CHUNK_SIZE];
+    
+    while (first != last) {
+        int count = static_cast<int>(last - first);
+        if (count > CHUNK_SIZE) {
+            count = CHUNK_SIZE;
+        }
+        
+        for (int i = 0; i < count; i++) {
+            Enemy& enemy = *first[i];
+            enemy.m_y += speed * deltaTime;
+            enemy.m_movementTimer += deltaTime;
+            xs[i] = enemy.m_x;
+            timers[i] = enemy.m_movementTimer;
+        }
+        
+        Movement::stepBatch(xs, timers, count, horizontalSpeed, frequency, deltaTime, playerX);
+        
+        for (int i = 0; i < count; i++) {
+            Enemy& enemy = *first[i];
+            enemy.m_x = xs[i];
+            enemy.m_blinkTimer += deltaTime;
+            enemy.updateShootTimer(deltaTime, burstCount);
+        }
+        
+        first += count;
+    }
+}
+
+void Enemy::updateBatch(std::unique_ptr<Enemy>* first, std::unique_ptr<Enemy>* last, float deltaTime, float playerX) {
+    if (first == last) {
+        return;
+    }
+    
+    // Resolve the movement policy once per batch
+    switch (getArchetype((*first)->m_type).movement) {
+        case MovementKind::CHASE:
+            updateBatchWith<ChaseMovement>(first, last, deltaTime, playerX);
+            break;
+        case MovementKind::ZIGZAG:
+            updateBatchWith<ZigzagMovement>(first, last, deltaTime, playerX);
+            break;
+    }
+}
+
+void Enemy::draw(std::vector<SpriteDraw>& out, SpriteId sprite) const {
     SDL_Rect rect = {
         static_cast<int>(m_x),
         static_cast<int>(m_y),
         static_cast<int>(m_width),
         static_cast<int>(m_height)
     };
-    SDL_RenderFillRect(renderer, &rect);
+    // Fallback: red rectangle
+    out.push_back({rect, sprite, 255, {255, 50, 50, 255}, false});
 }
 
 bool Enemy::isOffScreen() const {
     return m_y > 1200;  // Increased for taller screen
 }
 
-void Enemy::render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect) {
-    if (texture) {
-        SDL_Rect dstRect = {
-            static_cast<int>(m_x),
-            static_cast<int>(m_y),
-            static_cast<int>(m_width),
-            static_cast<int>(m_height)
-        };
+float Enemy::validateMovement(float seconds, float deltaTime) {
+    // Replay every zigzag archetype through the batched path and compare with
+    // the original per-enemy std::sin integration
+    float maxError = 0.0f;
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        const EnemyArchetype& archetype = ENEMY_ARCHETYPES[t];
+        if (archetype.movement != MovementKind::ZIGZAG) {
+            continue;
+        }
         
-        // If srcRect is nullptr, use entire texture
-        SDL_RenderCopy(renderer, texture, srcRect, &dstRect);
-    } else {
-        // Fallback: default rendering
-        render(renderer);
+        std::unique_ptr<Enemy> enemy = std::make_unique<Enemy>(200.0f, 0.0f, static_cast<EnemyType>(t));
+        float referenceX = 200.0f;
+        float referenceTimer = 0.0f;
+        for (float time = 0.0f; time < seconds; time += deltaTime) {
+            referenceTimer += deltaTime;
+            referenceX += archetype.horizontalSpeed * std::sin(referenceTimer * archetype.frequency) * deltaTime;
+            updateBatch(&enemy, &enemy + 1, deltaTime, -1.0f);
+            
+            float error = std::fabs(enemy->m_x - referenceX);
+            if (error > maxError) {
+                maxError = error;
+            }
+        }
     }
+    return maxError;
 }
@@ -0,0 +1,64 @@
+#include "FrameArena.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdint>
+
+FrameArena::FrameArena(size_t capacity)
+    : m_block(new std::byte[capacity])
+    , m_capacity(capacity)
+    , m_offset(0)
+    , m_overflowBytes(0)
+    , m_highWater(0)
+{
+    m_overflow.reserve(16);
+}
+
+FrameArena::~FrameArena() {
+    reset();
+}
+
+void FrameArena::reset() {
+    size_t used = m_offset + m_overflowBytes;
+    m_highWater = std::max(m_highWater, used);
+
+    for (const auto& overflow : m_overflow) {
+        ::operator delete(overflow.first, std::align_val_t(overflow.second));
+    }
+    m_overflow.clear();
+
+    // Outgrew the block: replace it once with one that holds the whole frame, plus headroom
+    if (m_overflowBytes > 0) {
+        size_t capacity = m_highWater + m_highWater / 2;
+        SDL_Log("INFO: Frame arena grew from %zu to %zu bytes", m_capacity, capacity);
+        m_block.reset(new std::byte[capacity]);
+        m_capacity = capacity;
+    }
+    m_offset = 0;
+    m_overflowBytes = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(m_block.get());
+    size_t start = ((base + m_offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+    if (start + bytes <= m_capacity) {
+        m_offset = start + bytes;
+        return m_block.get() + start;
+    }
+
+    // Block exhausted: heap until the next reset()
+    void* pointer = ::operator new(bytes, std::align_val_t(alignment));
+    m_overflow.push_back({pointer, alignment});
+    m_overflowBytes += bytes;
+    return pointer;
+}
+
+void FrameArena::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    // Freed all at once by reset()
+    (void)pointer;
+    (void)bytes;
+    (void)alignment;
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
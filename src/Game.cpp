@@ -1,9 +1,16 @@
 #include "Game.h"
+#include "AllocationTracker.h"
+#include "StateBuffer.h"
+#include "EnemyArchetype.h"
 #include <cstdlib>
+#include <cstdio>
+#include <cstdarg>
 #include <ctime>
 #include <cmath>
 #include <fstream>
 #include <algorithm>
+#include <cassert>
+#include <chrono>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -22,45 +29,192 @@ std::string getResourcePath(const std::string& filename) {
 #endif
 }
 
-Game::Game() 
+// Packed asset archive, next to the executable (built from assets/ by AssetPacker)
+std::string getArchivePath() {
+#ifdef _WIN32
+    char buffer[MAX_PATH];
+    GetModuleFileNameA(NULL, buffer, MAX_PATH);
+    std::string::size_type pos = std::string(buffer).find_last_of("\\/");
+    std::string exePath = std::string(buffer).substr(0, pos);
+    return exePath + "\\assets.pak";
+#else
+    return "assets.pak";
+#endif
+}
+
+// Stage music: stage 1 and 2 have their own track, later stages reuse the title music
+static MusicTrack getStageTrack(int stage) {
+    switch (stage) {
+        case 1: return MusicTrack::STAGE_01;
+        case 2: return MusicTrack::STAGE_02;
+        default: return MusicTrack::TITLE;
+    }
+}
+
+// Boss music cycles through the four boss tracks
+static MusicTrack getBossTrack(int stage) {
+    int index = (stage - 1) % 4;
+    return static_cast<MusicTrack>(static_cast<int>(MusicTrack::BOSS_01) + index);
+}
+
+// Minimum entities per parallel job
+const size_t ENEMY_JOB_GRAIN = 256;
+const size_t BULLET_JOB_GRAIN = 1024;
+const size_t COLLISION_CELL_GRAIN = 8;
+
+// Per-tick scratch sized for busy stages up front; a new peak grows them once
+const size_t GRID_BULLET_RESERVE = 1024;
+const size_t GRID_ENEMY_RESERVE = 256;
+const size_t GRID_TARGET_RESERVE = 64;
+const size_t THREAD_CONTACT_RESERVE = 256;
+const size_t THREAD_SHOT_RESERVE = 256;
+
+// Missiles fired from this missile level on home in on ground targets
+const int HOMING_MISSILE_LEVEL = 3;
+const int MISSILE_TARGET_CANDIDATES = 4;  // Nearest targets checked for one ahead of the missile
+
+// Pickup pool sizes: boxes live ~17 s in the item zone at 2-3 per 2 s
+const size_t POWER_UP_POOL_SIZE = 32;
+const size_t ITEM_BOX_POOL_SIZE = 48;
+
+// Compact a vector in place, keeping order, dropping items whose flag is set
+template <typename T, typename Flags>
+static void removeFlagged(std::vector<T>& items, const Flags& removed) {
+    size_t kept = 0;
+    for (size_t i = 0; i < items.size(); i++) {
+        if (!removed[i]) {
+            if (kept != i) {
+                items[kept] = std::move(items[i]);
+            }
+            kept++;
+        }
+    }
+    items.erase(items.begin() + kept, items.end());
+}
+
+// Lets GCC/Clang check printf-style arguments (-Wformat); MSVC has no equivalent attribute
+#if defined(__GNUC__) || defined(__clang__)
+#define PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#define PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
+// printf into a string allocated from a frame arena
+PRINTF_FORMAT(2, 3)
+static std::pmr::string formatText(std::pmr::memory_resource* arena, const char* format, ...) {
+    char buffer[64];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return std::pmr::string(buffer, arena);
+}
+
+// Snapshot layout: bump when the set or order of saved values changes
+const uint32_t STATE_MAGIC = 0x53534F41;  // "ASOS"
+const uint32_t STATE_VERSION = 4;
+
+struct StateHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;  // Whole buffer, header included
+    uint16_t objectSizes[8];  // Catches builds whose entity layout differs
+};
+
+static void getStateObjectSizes(uint16_t* sizes) {
+    const size_t values[8] = {sizeof(Player), sizeof(Enemy), sizeof(Boss), sizeof(Bullet),
+                              sizeof(PowerUp), sizeof(ItemBox), sizeof(Random), sizeof(StageEvent)};
+    for (int i = 0; i < 8; i++) {
+        sizes[i] = static_cast<uint16_t>(values[i]);
+    }
+}
+
+// Entity lists are a count followed by the objects
+template <typename Ptr>
+static void writeEntities(StateWriter& writer, const std::vector<Ptr>& items) {
+    writer.write(static_cast<uint32_t>(items.size()));
+    for (const Ptr& item : items) {
+        writer.write(*item);
+    }
+}
+
+// Objects already in the list are overwritten in place; make(value) adds the rest
+template <typename Ptr, typename Make>
+static bool readEntities(StateReader& reader, std::vector<Ptr>& items, Make make) {
+    using T = typename Ptr::element_type;
+    uint32_t count = 0;
+    if (!reader.read(count)) {
+        return false;
+    }
+    if (count < items.size()) {
+        items.erase(items.begin() + count, items.end());
+    }
+    alignas(T) unsigned char storage[sizeof(T)];
+    for (uint32_t i = 0; i < count; i++) {
+        const T* value = reader.readObject<T>(storage);
+        if (!value) {
+            return false;
+        }
+        if (i < items.size()) {
+            *items[i] = *value;
+        } else {
+            items.push_back(make(*value));
+        }
+    }
+    return true;
+}
+
+// Autopilot pause on the title and results screens before starting the next game
+const float AUTOPILOT_RESTART_DELAY = 2.0f;
+
+// Longest int for 7-segment numbers: sign + 10 digits
+const int MAX_NUMBER_DIGITS = 11;
+
+// Player explosion animation (boom01-06)
+const int PLAYER_EXPLOSION_FRAMES = 6;
+const float PLAYER_EXPLOSION_FRAME_TIME = 0.1f;  // Seconds per frame
+
+Game::Game(unsigned jobWorkers)
     : m_window(nullptr)
     , m_renderer(nullptr)
     , m_running(false)
+    , m_windowWidth(0)
+    , m_windowHeight(0)
+    , m_headless(false)
+    , m_simulationRunning(false)
+    , m_simulationTick(0)
+    , m_jobs(jobWorkers)
     , m_mouseGrabbed(true)  // Locked by default
+    , m_powerUpPool("PowerUp")
+    , m_itemBoxPool("ItemBox")
+    , m_stagePoolBlocks(0)
+    , m_poolGrowthBlocks(0)
+    , m_autopilotEnabled(false)
+    , m_autopilotIdleTimer(0.0f)
+    , m_sessionCount(0)
+    , m_sessionStats()
     , m_enemySpawnTimer(0.0f)
+    , m_enemySpawnInterval(0.0f)
     , m_gameState(GameState::START_SCREEN)
     , m_stateTimer(0.0f)
+    , m_explosionTimer(0.0f)
+    , m_explosionX(0.0f)
+    , m_explosionY(0.0f)
     , m_lives(3)
     , m_score(0)
     , m_highScore(0)
     , m_shootSound(nullptr)
     , m_explosionSound(nullptr)
-    , m_bgMusic(nullptr)
-    , m_stage01Music(nullptr)
-    , m_stage02Music(nullptr)
-    , m_boss01Music(nullptr)
-    , m_boss02Music(nullptr)
-    , m_boss03Music(nullptr)
-    , m_boss04Music(nullptr)
-    , m_backgroundTexture(nullptr)
-    , m_background01Texture(nullptr)
-    , m_background02Texture(nullptr)
-    , m_background03Texture(nullptr)
-    , m_background04Texture(nullptr)
-    , m_bgSlot1Texture(nullptr)
-    , m_bgSlot2Texture(nullptr)
+    , m_bossHitSound(nullptr)
+    , m_bgSlot1(SpriteId::NONE)
+    , m_bgSlot2(SpriteId::NONE)
     , m_backgroundY1(0.0f)
     , m_backgroundY2(-960.0f)
     , m_backgroundScrollSpeed(50.0f)
-    , m_bgSequenceIndex(0)
-    , m_bg03LoopCount(0)
-    , m_maxBg03Loops(3)
-    , m_currentSequenceTexture(nullptr)
-    , m_nextSequenceTexture(nullptr)
-    , m_bossSpawnTimer(0.0f)
-    , m_bg04Completed(false)
+    , m_nextSequenceSprite(SpriteId::NONE)
     , m_itemBoxSpawnTimer(0.0f)
-    , m_inSpaceCity(false)
+    , m_itemBoxSpawnInterval(2.0f)
+    , m_itemZoneActive(false)
     , m_playerTexture(nullptr)
     , m_shipStopTexture(nullptr)
     , m_shipForwardTexture(nullptr)
@@ -77,6 +231,7 @@ Game::Game()
     , m_boss(nullptr)
     , m_enemyKillCount(0)
     , m_currentStage(1)
+    , m_stageTime(0.0f)
     , m_boom01Texture(nullptr)
     , m_boom02Texture(nullptr)
     , m_boom03Texture(nullptr)
@@ -92,9 +247,30 @@ Game::Game()
     , m_subtitleFont(nullptr)
     , m_titleTexture(nullptr)
     , m_startLogoTexture(nullptr)
+    , m_hudTexture(nullptr)
+    , m_hudValues()
+    , m_hudDirty(true)
+    , m_backgroundStrip(nullptr)
+    , m_stripUpper(SpriteId::NONE)
+    , m_stripLower(SpriteId::NONE)
+    , m_backgroundsPrepared(false)
     , m_blinkTimer(0.0f)
     , m_fadeAlpha(0)
 {
+    for (SDL_Texture*& sprite : m_sprites) {
+        sprite = nullptr;
+    }
+    m_workerCommands.resize(m_jobs.getThreadCount());
+    m_threadContacts.resize(m_jobs.getThreadCount());
+    for (WorkerCommands& commands : m_workerCommands) {
+        commands.enemyShots.reserve(THREAD_SHOT_RESERVE);
+    }
+    for (std::vector<Contact>& contacts : m_threadContacts) {
+        contacts.reserve(THREAD_CONTACT_RESERVE);
+    }
+    m_bulletGrid.reserve(GRID_BULLET_RESERVE);
+    m_enemyGrid.reserve(GRID_ENEMY_RESERVE);
+    m_targetGrid.reserve(GRID_TARGET_RESERVE);
     loadHighScores();
 }
 
@@ -123,8 +299,16 @@ bool Game::init(const char* title, int width, int height) {
         return false;
     }
     
+    m_windowWidth = width;
+    m_windowHeight = height;
+    
     // Update background positions based on actual window height
     m_backgroundY2 = -static_cast<float>(height);
+    
+    // Collision grid covers the screen plus the spawn area above it
+    m_bulletGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
+    m_enemyGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
+    m_targetGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
 
     // Create renderer
     m_renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED);
@@ -133,6 +317,17 @@ bool Game::init(const char* title, int width, int height) {
         return false;
     }
     
+    // HUD layer (transparent render target the size of the window)
+    if (SDL_RenderTargetSupported(m_renderer)) {
+        m_hudTexture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (m_hudTexture) {
+            SDL_SetTextureBlendMode(m_hudTexture, SDL_BLENDMODE_BLEND);
+        }
+    }
+    if (!m_hudTexture) {
+        SDL_Log("INFO: HUD render target unavailable, drawing HUD every frame");
+    }
+    
     // Initialize SDL_ttf
     if (TTF_Init() == -1) {
         SDL_Log("Failed to initialize TTF: %s", TTF_GetError());
@@ -140,17 +335,25 @@ bool Game::init(const char* title, int width, int height) {
     }
 
     // Initialize random seed
-    srand(static_cast<unsigned>(time(nullptr)));
+    m_random.reseed(static_cast<uint64_t>(time(nullptr)));
+
+    // Map the asset archive; anything not in it is loaded from assets/ as before
+    if (!m_assets.open(getArchivePath())) {
+        SDL_Log("INFO: No asset archive, loading loose files from assets/");
+    }
 
     // Initialize SDL_mixer
     if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
         SDL_Log("Failed to initialize SDL_mixer: %s", Mix_GetError());
         // Continue without sound
+    } else {
+        m_audioCache.open("audiocache", m_assets.isOpen() ? &m_assets : nullptr);
+        m_soundVoices.init(16, static_cast<float>(width), static_cast<float>(height));
     }
     
     // Load sound files (WAV format, Mix_Chunk)
     std::string shootPath = getResourcePath("shot_01.wav");
-    m_shootSound = Mix_LoadWAV(shootPath.c_str());
+    m_shootSound = loadSound(shootPath);
     if (!m_shootSound) {
         SDL_Log("INFO: Failed to load shot_01.wav: %s (path: %s)", Mix_GetError(), shootPath.c_str());
     } else {
@@ -158,41 +361,39 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string explosionPath = getResourcePath("explosion_01.wav");
-    m_explosionSound = Mix_LoadWAV(explosionPath.c_str());
+    m_explosionSound = loadSound(explosionPath);
     if (!m_explosionSound) {
         SDL_Log("INFO: Failed to load explosion_01.wav: %s (path: %s)", Mix_GetError(), explosionPath.c_str());
     } else {
         SDL_Log("INFO: Loaded explosion_01.wav: %s", explosionPath.c_str());
     }
     
-    // Load background music (WAV format, Mix_Music)
-    std::string bgMusicPath = getResourcePath("aso_plus_opening2.wav");
-    m_bgMusic = Mix_LoadMUS(bgMusicPath.c_str());
-    if (!m_bgMusic) {
-        SDL_Log("INFO: Failed to load aso_plus_opening2.wav: %s (path: %s)", Mix_GetError(), bgMusicPath.c_str());
-    } else {
-        SDL_Log("INFO: Loaded aso_plus_opening2.wav: %s", bgMusicPath.c_str());
-        // Play background music infinitely (-1 = loop)
-        Mix_PlayMusic(m_bgMusic, -1);
-        Mix_VolumeMusic(64); // Volume 50% (0-128)
-    }
-    
-    // Load stage music
-    std::string stage01Path = getResourcePath("stage01.wav");
-    m_stage01Music = Mix_LoadMUS(stage01Path.c_str());
-    if (m_stage01Music) {
-        SDL_Log("INFO: Loaded stage01.wav: %s", stage01Path.c_str());
-    } else {
-        SDL_Log("INFO: Failed to load stage01.wav: %s", Mix_GetError());
-    }
-    
-    // Load boss music
-    std::string boss01MusicPath = getResourcePath("boss01.wav");
-    m_boss01Music = Mix_LoadMUS(boss01MusicPath.c_str());
-    if (m_boss01Music) {
-        SDL_Log("INFO: Loaded boss01.wav: %s", boss01MusicPath.c_str());
-    } else {
-        SDL_Log("INFO: Failed to load boss01.wav: %s", Mix_GetError());
+    std::string bossHitPath = getResourcePath("metal_collision.mp3");
+    m_bossHitSound = loadSound(bossHitPath);
+    if (m_bossHitSound) {
+        SDL_Log("INFO: Loaded metal_collision.mp3: %s", bossHitPath.c_str());
+    }
+    
+    // Voice limits: priority (higher wins channels), max voices, min retrigger seconds, volume
+    m_soundVoices.registerSound(SoundId::LASER, m_shootSound, 1, 3, 0.05f, 32);
+    m_soundVoices.registerSound(SoundId::MISSILE, m_shootSound, 2, 2, 0.1f, 32);
+    m_soundVoices.registerSound(SoundId::PICKUP, m_shootSound, 3, 2, 0.05f, 32);
+    m_soundVoices.registerSound(SoundId::ITEM_BOX_OPEN, m_explosionSound, 4, 2, 0.05f, MIX_MAX_VOLUME);
+    m_soundVoices.registerSound(SoundId::ENEMY_EXPLOSION, m_explosionSound, 4, 4, 0.03f, MIX_MAX_VOLUME);
+    m_soundVoices.registerSound(SoundId::BOSS_HIT, m_bossHitSound, 5, 2, 0.08f, 96);
+    m_soundVoices.registerSound(SoundId::PLAYER_DEATH, m_explosionSound, 6, 1, 0.0f, MIX_MAX_VOLUME);
+    
+    // Music: decoded on the controller's loader thread, crossfaded in the mixer
+    m_music.setTrack(MusicTrack::TITLE, getResourcePath("aso_plus_opening2.wav"), MusicTrack::NONE);
+    m_music.setTrack(MusicTrack::STAGE_01, getResourcePath("stage01.wav"), MusicTrack::TITLE);
+    m_music.setTrack(MusicTrack::STAGE_02, getResourcePath("stage02.wav"), MusicTrack::TITLE);
+    m_music.setTrack(MusicTrack::BOSS_01, getResourcePath("boss01.wav"), MusicTrack::NONE);
+    m_music.setTrack(MusicTrack::BOSS_02, getResourcePath("boss02.wav"), MusicTrack::NONE);
+    m_music.setTrack(MusicTrack::BOSS_03, getResourcePath("boss03.wav"), MusicTrack::NONE);
+    m_music.setTrack(MusicTrack::BOSS_04, getResourcePath("boss04.wav"), MusicTrack::NONE);
+    if (m_music.start([this](const std::string& path) { return loadSound(path); })) {
+        m_music.play(MusicTrack::TITLE, 64, 0.0f);  // Volume 50% (0-128)
+        m_music.prepare(getStageTrack(1));
     }
 
     // Load sprite images (PNG with transparency support)
@@ -201,72 +402,28 @@ bool Game::init(const char* title, int width, int height) {
         SDL_Log("Failed to initialize SDL_image: %s", IMG_GetError());
     }
     
-    // Load background image (background.png)
-    std::string bgPath = getResourcePath("background.png");
-    SDL_Surface* bgSurface = IMG_Load(bgPath.c_str());
-    if (bgSurface) {
-        m_backgroundTexture = SDL_CreateTextureFromSurface(m_renderer, bgSurface);
-        SDL_FreeSurface(bgSurface);
-        
-        if (m_backgroundTexture) {
-            SDL_Log("INFO: Loaded background.png: %s", bgPath.c_str());
-        }
-    } else {
-        SDL_Log("INFO: Failed to load background.png: %s (path: %s)", IMG_GetError(), bgPath.c_str());
-    }
-    
-    // Load background textures (background01 ~ background04)
-    std::string bg01Path = getResourcePath("background01.png");
-    SDL_Surface* bg01Surface = IMG_Load(bg01Path.c_str());
-    if (bg01Surface) {
-        m_background01Texture = SDL_CreateTextureFromSurface(m_renderer, bg01Surface);
-        SDL_FreeSurface(bg01Surface);
-        if (m_background01Texture) {
-            SDL_Log("INFO: Loaded background01.png: %s", bg01Path.c_str());
-        }
-    }
-    
-    std::string bg02Path = getResourcePath("background02.png");
-    SDL_Surface* bg02Surface = IMG_Load(bg02Path.c_str());
-    if (bg02Surface) {
-        m_background02Texture = SDL_CreateTextureFromSurface(m_renderer, bg02Surface);
-        SDL_FreeSurface(bg02Surface);
-        if (m_background02Texture) {
-            SDL_Log("INFO: Loaded background02.png: %s", bg02Path.c_str());
-        }
-    }
-    
-    std::string bg03Path = getResourcePath("background03.png");
-    SDL_Surface* bg03Surface = IMG_Load(bg03Path.c_str());
-    if (bg03Surface) {
-        m_background03Texture = SDL_CreateTextureFromSurface(m_renderer, bg03Surface);
-        SDL_FreeSurface(bg03Surface);
-        if (m_background03Texture) {
-            SDL_Log("INFO: Loaded background03.png: %s", bg03Path.c_str());
-        }
-    }
-    
-    std::string bg04Path = getResourcePath("background04.png");
-    SDL_Surface* bg04Surface = IMG_Load(bg04Path.c_str());
-    if (bg04Surface) {
-        m_background04Texture = SDL_CreateTextureFromSurface(m_renderer, bg04Surface);
-        SDL_FreeSurface(bg04Surface);
-        if (m_background04Texture) {
-            SDL_Log("INFO: Loaded background04.png: %s", bg04Path.c_str());
-        }
-    }
+    // Backgrounds stream in on demand; only the visible and queued segments stay resident.
+    // assets/stage1.png and stage1-02.png ship too but were never loaded, so they stay unregistered
+    m_backgroundStreamer.setPath(SpriteId::BACKGROUND, getResourcePath("background.png"));
+    m_backgroundStreamer.setPath(SpriteId::BACKGROUND_01, getResourcePath("background01.png"));
+    m_backgroundStreamer.setPath(SpriteId::BACKGROUND_02, getResourcePath("background02.png"));
+    m_backgroundStreamer.setPath(SpriteId::BACKGROUND_03, getResourcePath("background03.png"));
+    m_backgroundStreamer.setPath(SpriteId::BACKGROUND_04, getResourcePath("background04.png"));
+    m_backgroundStreamer.setArchive(m_assets.isOpen() ? &m_assets : nullptr);
+    m_backgroundStreamer.start(m_renderer, width, height);
     
     // Initialize background scrolling slots
-    // Both slots start with background01, next will be background02
-    m_bgSlot1Texture = m_background01Texture;
-    m_bgSlot2Texture = m_background01Texture;  // Same as slot1 initially
-    m_bgSequenceIndex = 0;  // Starting with bg01
-    m_currentSequenceTexture = m_background01Texture;
-    m_nextSequenceTexture = m_background02Texture;  // 02 will come after 01
+    // Both slots start with background01, the stage script queues what follows
+    m_bgSlot1 = SpriteId::BACKGROUND_01;
+    m_bgSlot2 = SpriteId::BACKGROUND_01;  // Same as slot1 initially
+    m_nextSequenceSprite = SpriteId::BACKGROUND_01;
+    
+    // Load stage timeline
+    loadStageScript(m_currentStage);
     
     // Load player sprite (ship_01.png) - legacy
     std::string playerSpritePath = getResourcePath("ship_01.png");
-    SDL_Surface* playerSurface = IMG_Load(playerSpritePath.c_str());
+    SDL_Surface* playerSurface = loadImage(playerSpritePath);
     if (playerSurface) {
         // Set white background as transparent (RGB: 255, 255, 255)
         SDL_SetColorKey(playerSurface, SDL_TRUE, SDL_MapRGB(playerSurface->format, 255, 255, 255));
@@ -284,7 +441,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load ship_stop sprite
     std::string shipStopPath = getResourcePath("ship_stop.png");
-    SDL_Surface* shipStopSurface = IMG_Load(shipStopPath.c_str());
+    SDL_Surface* shipStopSurface = loadImage(shipStopPath);
     if (shipStopSurface) {
         SDL_SetColorKey(shipStopSurface, SDL_TRUE, SDL_MapRGB(shipStopSurface->format, 255, 255, 255));
         m_shipStopTexture = SDL_CreateTextureFromSurface(m_renderer, shipStopSurface);
@@ -299,7 +456,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load ship_forward sprite
     std::string shipForwardPath = getResourcePath("ship_forward.png");
-    SDL_Surface* shipForwardSurface = IMG_Load(shipForwardPath.c_str());
+    SDL_Surface* shipForwardSurface = loadImage(shipForwardPath);
     if (shipForwardSurface) {
         SDL_SetColorKey(shipForwardSurface, SDL_TRUE, SDL_MapRGB(shipForwardSurface->format, 255, 255, 255));
         m_shipForwardTexture = SDL_CreateTextureFromSurface(m_renderer, shipForwardSurface);
@@ -314,7 +471,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load ship_backward sprite
     std::string shipBackwardPath = getResourcePath("ship_backward.png");
-    SDL_Surface* shipBackwardSurface = IMG_Load(shipBackwardPath.c_str());
+    SDL_Surface* shipBackwardSurface = loadImage(shipBackwardPath);
     if (shipBackwardSurface) {
         SDL_SetColorKey(shipBackwardSurface, SDL_TRUE, SDL_MapRGB(shipBackwardSurface->format, 255, 255, 255));
         m_shipBackwardTexture = SDL_CreateTextureFromSurface(m_renderer, shipBackwardSurface);
@@ -329,7 +486,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load ship_left sprite
     std::string shipLeftPath = getResourcePath("ship_left.png");
-    SDL_Surface* shipLeftSurface = IMG_Load(shipLeftPath.c_str());
+    SDL_Surface* shipLeftSurface = loadImage(shipLeftPath);
     if (shipLeftSurface) {
         SDL_SetColorKey(shipLeftSurface, SDL_TRUE, SDL_MapRGB(shipLeftSurface->format, 255, 255, 255));
         m_shipLeftTexture = SDL_CreateTextureFromSurface(m_renderer, shipLeftSurface);
@@ -344,7 +501,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load ship_right sprite
     std::string shipRightPath = getResourcePath("ship_right.png");
-    SDL_Surface* shipRightSurface = IMG_Load(shipRightPath.c_str());
+    SDL_Surface* shipRightSurface = loadImage(shipRightPath);
     if (shipRightSurface) {
         SDL_SetColorKey(shipRightSurface, SDL_TRUE, SDL_MapRGB(shipRightSurface->format, 255, 255, 255));
         m_shipRightTexture = SDL_CreateTextureFromSurface(m_renderer, shipRightSurface);
@@ -359,7 +516,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load enemy sprites (enemy_01 ~ enemy_05)
     std::string enemy01Path = getResourcePath("enemy_01.png");
-    SDL_Surface* enemy01Surface = IMG_Load(enemy01Path.c_str());
+    SDL_Surface* enemy01Surface = loadImage(enemy01Path);
     if (enemy01Surface) {
         SDL_SetColorKey(enemy01Surface, SDL_TRUE, SDL_MapRGB(enemy01Surface->format, 255, 255, 255));
         m_enemy01Texture = SDL_CreateTextureFromSurface(m_renderer, enemy01Surface);
@@ -373,7 +530,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string enemy02Path = getResourcePath("enemy_02.png");
-    SDL_Surface* enemy02Surface = IMG_Load(enemy02Path.c_str());
+    SDL_Surface* enemy02Surface = loadImage(enemy02Path);
     if (enemy02Surface) {
         SDL_SetColorKey(enemy02Surface, SDL_TRUE, SDL_MapRGB(enemy02Surface->format, 255, 255, 255));
         m_enemy02Texture = SDL_CreateTextureFromSurface(m_renderer, enemy02Surface);
@@ -387,7 +544,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string enemy03Path = getResourcePath("enemy_03.png");
-    SDL_Surface* enemy03Surface = IMG_Load(enemy03Path.c_str());
+    SDL_Surface* enemy03Surface = loadImage(enemy03Path);
     if (enemy03Surface) {
         SDL_SetColorKey(enemy03Surface, SDL_TRUE, SDL_MapRGB(enemy03Surface->format, 255, 255, 255));
         m_enemy03Texture = SDL_CreateTextureFromSurface(m_renderer, enemy03Surface);
@@ -401,7 +558,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string enemy04Path = getResourcePath("enemy_04.png");
-    SDL_Surface* enemy04Surface = IMG_Load(enemy04Path.c_str());
+    SDL_Surface* enemy04Surface = loadImage(enemy04Path);
     if (enemy04Surface) {
         SDL_SetColorKey(enemy04Surface, SDL_TRUE, SDL_MapRGB(enemy04Surface->format, 255, 255, 255));
         m_enemy04Texture = SDL_CreateTextureFromSurface(m_renderer, enemy04Surface);
@@ -415,7 +572,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string enemy05Path = getResourcePath("enemy_05.png");
-    SDL_Surface* enemy05Surface = IMG_Load(enemy05Path.c_str());
+    SDL_Surface* enemy05Surface = loadImage(enemy05Path);
     if (enemy05Surface) {
         SDL_SetColorKey(enemy05Surface, SDL_TRUE, SDL_MapRGB(enemy05Surface->format, 255, 255, 255));
         m_enemy05Texture = SDL_CreateTextureFromSurface(m_renderer, enemy05Surface);
@@ -433,7 +590,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load boss sprites
     std::string boss01Path = getResourcePath("boss01.png");
-    SDL_Surface* boss01Surface = IMG_Load(boss01Path.c_str());
+    SDL_Surface* boss01Surface = loadImage(boss01Path);
     if (boss01Surface) {
         SDL_SetColorKey(boss01Surface, SDL_TRUE, SDL_MapRGB(boss01Surface->format, 255, 255, 255));
         m_boss01Texture = SDL_CreateTextureFromSurface(m_renderer, boss01Surface);
@@ -448,7 +605,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load boom explosion sprites
     std::string boom01Path = getResourcePath("boom01.png");
-    SDL_Surface* boom01Surface = IMG_Load(boom01Path.c_str());
+    SDL_Surface* boom01Surface = loadImage(boom01Path);
     if (boom01Surface) {
         SDL_SetColorKey(boom01Surface, SDL_TRUE, SDL_MapRGB(boom01Surface->format, 255, 255, 255));
         m_boom01Texture = SDL_CreateTextureFromSurface(m_renderer, boom01Surface);
@@ -462,7 +619,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string boom02Path = getResourcePath("boom02.png");
-    SDL_Surface* boom02Surface = IMG_Load(boom02Path.c_str());
+    SDL_Surface* boom02Surface = loadImage(boom02Path);
     if (boom02Surface) {
         SDL_SetColorKey(boom02Surface, SDL_TRUE, SDL_MapRGB(boom02Surface->format, 255, 255, 255));
         m_boom02Texture = SDL_CreateTextureFromSurface(m_renderer, boom02Surface);
@@ -476,7 +633,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string boom03Path = getResourcePath("boom03.png");
-    SDL_Surface* boom03Surface = IMG_Load(boom03Path.c_str());
+    SDL_Surface* boom03Surface = loadImage(boom03Path);
     if (boom03Surface) {
         SDL_SetColorKey(boom03Surface, SDL_TRUE, SDL_MapRGB(boom03Surface->format, 255, 255, 255));
         m_boom03Texture = SDL_CreateTextureFromSurface(m_renderer, boom03Surface);
@@ -490,7 +647,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string boom04Path = getResourcePath("boom04.png");
-    SDL_Surface* boom04Surface = IMG_Load(boom04Path.c_str());
+    SDL_Surface* boom04Surface = loadImage(boom04Path);
     if (boom04Surface) {
         SDL_SetColorKey(boom04Surface, SDL_TRUE, SDL_MapRGB(boom04Surface->format, 255, 255, 255));
         m_boom04Texture = SDL_CreateTextureFromSurface(m_renderer, boom04Surface);
@@ -504,7 +661,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string boom05Path = getResourcePath("boom05.png");
-    SDL_Surface* boom05Surface = IMG_Load(boom05Path.c_str());
+    SDL_Surface* boom05Surface = loadImage(boom05Path);
     if (boom05Surface) {
         SDL_SetColorKey(boom05Surface, SDL_TRUE, SDL_MapRGB(boom05Surface->format, 255, 255, 255));
         m_boom05Texture = SDL_CreateTextureFromSurface(m_renderer, boom05Surface);
@@ -518,7 +675,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string boom06Path = getResourcePath("boom06.png");
-    SDL_Surface* boom06Surface = IMG_Load(boom06Path.c_str());
+    SDL_Surface* boom06Surface = loadImage(boom06Path);
     if (boom06Surface) {
         SDL_SetColorKey(boom06Surface, SDL_TRUE, SDL_MapRGB(boom06Surface->format, 255, 255, 255));
         m_boom06Texture = SDL_CreateTextureFromSurface(m_renderer, boom06Surface);
@@ -533,7 +690,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load item box textures
     std::string itemBoxPath = getResourcePath("item_b.png");
-    SDL_Surface* itemBoxSurface = IMG_Load(itemBoxPath.c_str());
+    SDL_Surface* itemBoxSurface = loadImage(itemBoxPath);
     if (itemBoxSurface) {
         m_itemBoxTexture = SDL_CreateTextureFromSurface(m_renderer, itemBoxSurface);
         SDL_FreeSurface(itemBoxSurface);
@@ -543,7 +700,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string itemSPath = getResourcePath("item_s.png");
-    SDL_Surface* itemSSurface = IMG_Load(itemSPath.c_str());
+    SDL_Surface* itemSSurface = loadImage(itemSPath);
     if (itemSSurface) {
         m_itemSTexture = SDL_CreateTextureFromSurface(m_renderer, itemSSurface);
         SDL_FreeSurface(itemSSurface);
@@ -553,7 +710,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string itemLPath = getResourcePath("item_l.png");
-    SDL_Surface* itemLSurface = IMG_Load(itemLPath.c_str());
+    SDL_Surface* itemLSurface = loadImage(itemLPath);
     if (itemLSurface) {
         m_itemLTexture = SDL_CreateTextureFromSurface(m_renderer, itemLSurface);
         SDL_FreeSurface(itemLSurface);
@@ -563,7 +720,7 @@ bool Game::init(const char* title, int width, int height) {
     }
     
     std::string itemMPath = getResourcePath("item_m.png");
-    SDL_Surface* itemMSurface = IMG_Load(itemMPath.c_str());
+    SDL_Surface* itemMSurface = loadImage(itemMPath);
     if (itemMSurface) {
         m_itemMTexture = SDL_CreateTextureFromSurface(m_renderer, itemMSurface);
         SDL_FreeSurface(itemMSurface);
@@ -603,7 +760,7 @@ bool Game::init(const char* title, int width, int height) {
     
     // Load start logo image (start_logo.png)
     std::string startLogoPath = getResourcePath("start_logo.png");
-    SDL_Surface* startLogoSurface = IMG_Load(startLogoPath.c_str());
+    SDL_Surface* startLogoSurface = loadImage(startLogoPath);
     if (startLogoSurface) {
         m_startLogoTexture = SDL_CreateTextureFromSurface(m_renderer, startLogoSurface);
         SDL_FreeSurface(startLogoSurface);
@@ -619,30 +776,67 @@ bool Game::init(const char* title, int width, int height) {
     // Create player (centered at bottom of screen)
     m_player = std::make_unique<Player>(width / 2.0f, height - 80.0f);
     
+#ifndef NDEBUG
+    // Debug builds: batched fast-sine movement must stay on the reference std::sin trajectories
+    float movementError = Enemy::validateMovement(30.0f, 1.0f / 60.0f);
+    SDL_Log("INFO: Enemy movement check: max deviation %.4f px over 30s", movementError);
+    assert(movementError < 0.5f);
+#endif
+    
     // Confine mouse to window
     SDL_SetWindowGrab(m_window, SDL_TRUE);
     SDL_Log("INFO: Mouse grab enabled (ESC to release)");
 
+    // Resolve sprite IDs once textures are loaded, then publish the first frame
+    buildSpriteTable();
+    buildSnapshot(m_snapshots.back());
+    m_snapshots.publish();
+
+    m_running = true;
+    return true;
+}
+
+bool Game::initHeadless(int width, int height, uint64_t seed) {
+    m_headless = true;
+    m_windowWidth = width;
+    m_windowHeight = height;
+    m_backgroundY2 = -static_cast<float>(height);
+    
+    // Same field as init(): collision grids, backgrounds, stage timeline, player
+    m_bulletGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
+    m_enemyGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
+    m_targetGrid.setBounds(-64.0f, -static_cast<float>(height), width + 64.0f, height + 64.0f);
+    m_random.reseed(seed);
+    
+    m_bgSlot1 = SpriteId::BACKGROUND_01;
+    m_bgSlot2 = SpriteId::BACKGROUND_01;
+    m_nextSequenceSprite = SpriteId::BACKGROUND_01;
+    loadStageScript(m_currentStage);
+    
+    m_player = std::make_unique<Player>(width / 2.0f, height - 80.0f);
+    
     m_running = true;
     return true;
 }
 
 void Game::handleEvents() {
+    ALLOCATION_SCOPE("events");
     SDL_Event event;
+    std::lock_guard<std::mutex> lock(m_inputMutex);
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
             m_running = false;
         }
+        else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+            // Render target contents were lost
+            m_hudDirty = true;
+            releaseDigitStrips();
+            releaseBackgrounds();
+        }
         else if (event.type == SDL_KEYDOWN) {
             // ESC to toggle pause during gameplay
             if (event.key.keysym.sym == SDLK_ESCAPE) {
-                if (m_gameState == GameState::PLAYING) {
-                    m_gameState = GameState::PAUSED;
-                    SDL_Log("INFO: Game paused");
-                } else if (m_gameState == GameState::PAUSED) {
-                    m_gameState = GameState::PLAYING;
-                    SDL_Log("INFO: Game resumed");
-                }
+                m_inputQueue.push_back({InputCommand::TOGGLE_PAUSE, 0.0f, 0.0f});
             }
             // Ctrl+C to toggle mouse grab
             else if (event.key.keysym.sym == SDLK_c && (SDL_GetModState() & KMOD_CTRL)) {
@@ -650,81 +844,210 @@ void Game::handleEvents() {
                 SDL_SetWindowGrab(m_window, m_mouseGrabbed ? SDL_TRUE : SDL_FALSE);
                 SDL_Log("INFO: Mouse grab %s", m_mouseGrabbed ? "enabled" : "disabled");
             }
-            // Any key to start from START_SCREEN - go directly to countdown
-            else if (m_gameState == GameState::START_SCREEN) {
-                m_gameState = GameState::COUNTDOWN;
-                m_stateTimer = 5.0f;
-                m_lives = 3;
-                m_score = 0;
-                m_enemies.clear();
-                m_bullets.clear();
-                int windowWidth, windowHeight;
-                SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                m_player = std::make_unique<Player>(windowWidth / 2.0f, windowHeight - 80.0f);
+            // F5 / F9: quick save / quick load
+            else if (event.key.keysym.sym == SDLK_F5) {
+                m_inputQueue.push_back({InputCommand::QUICK_SAVE, 0.0f, 0.0f});
+            }
+            else if (event.key.keysym.sym == SDLK_F9) {
+                m_inputQueue.push_back({InputCommand::QUICK_LOAD, 0.0f, 0.0f});
             }
-            // Any key to start from GAME_OVER
-            else if (m_gameState == GameState::GAME_OVER) {
-                m_gameState = GameState::COUNTDOWN;
-                m_stateTimer = 5.0f;
-                m_lives = 3;
-                m_score = 0;
-                m_enemies.clear();
-                m_bullets.clear();
-                int windowWidth, windowHeight;
-                SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                m_player = std::make_unique<Player>(windowWidth / 2.0f, windowHeight - 80.0f);
+            // Any other key (starts the game from START_SCREEN / GAME_OVER)
+            else {
+                m_inputQueue.push_back({InputCommand::KEY_START, 0.0f, 0.0f});
             }
         }
         else if (event.type == SDL_MOUSEMOTION) {
-            if (m_gameState == GameState::PLAYING) {
-                // Update mouse position on motion
-                m_player->setMousePosition(static_cast<float>(event.motion.x), 
-                                           static_cast<float>(event.motion.y));
-            }
+            m_inputQueue.push_back({InputCommand::MOUSE_MOVE,
+                                    static_cast<float>(event.motion.x),
+                                    static_cast<float>(event.motion.y)});
         }
         else if (event.type == SDL_MOUSEBUTTONDOWN) {
             if (event.button.button == SDL_BUTTON_LEFT) {
-                m_mousePressed = true;
-                
-                // Click on START_SCREEN to start countdown directly
-                if (m_gameState == GameState::START_SCREEN) {
-                    m_gameState = GameState::COUNTDOWN;
-                    m_stateTimer = 2.0f;  // 2 seconds: 1s GET READY, 1s GO
-                    m_lives = 3;
-                    m_score = 0;
-                    m_enemies.clear();
-                    m_bullets.clear();
-                    int windowWidth, windowHeight;
-                    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                    m_player = std::make_unique<Player>(windowWidth / 2.0f, windowHeight - 80.0f);
-                }
-                // Click on GAME_OVER to start countdown
-                else if (m_gameState == GameState::GAME_OVER) {
-                    m_gameState = GameState::COUNTDOWN;
-                    m_stateTimer = 2.0f;  // 2 seconds: 1s GET READY, 1s GO
-                    m_lives = 3;
-                    m_score = 0;
-                    m_enemies.clear();
-                    m_bullets.clear();
-                    int windowWidth, windowHeight;
-                    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                    m_player = std::make_unique<Player>(windowWidth / 2.0f, windowHeight - 80.0f);
-                }
-                // Fire missiles with mouse click in PLAYING state
-                else if (m_gameState == GameState::PLAYING) {
-                    // Missile firing is now handled in update() with auto-fire
-                }
+                m_inputQueue.push_back({InputCommand::MOUSE_DOWN, 0.0f, 0.0f});
             }
         }
         else if (event.type == SDL_MOUSEBUTTONUP) {
             if (event.button.button == SDL_BUTTON_LEFT) {
-                m_mousePressed = false;
+                m_inputQueue.push_back({InputCommand::MOUSE_UP, 0.0f, 0.0f});
             }
         }
     }
 }
 
+void Game::applyInput() {
+    {
+        std::lock_guard<std::mutex> lock(m_inputMutex);
+        m_inputPending.swap(m_inputQueue);
+    }
+    
+    for (const InputEvent& input : m_inputPending) {
+        if (input.command == InputCommand::TOGGLE_PAUSE) {
+            if (m_gameState == GameState::PLAYING) {
+                m_gameState = GameState::PAUSED;
+                SDL_Log("INFO: Game paused");
+            } else if (m_gameState == GameState::PAUSED) {
+                m_gameState = GameState::PLAYING;
+                SDL_Log("INFO: Game resumed");
+            }
+        }
+        else if (input.command == InputCommand::KEY_START) {
+            // Any key on START_SCREEN or GAME_OVER - go directly to countdown
+            if (m_gameState == GameState::START_SCREEN || m_gameState == GameState::GAME_OVER) {
+                resetSession(ResetKind::NEW_GAME);
+            }
+        }
+        else if (input.command == InputCommand::MOUSE_MOVE) {
+            if (m_gameState == GameState::PLAYING) {
+                // Update mouse position on motion
+                m_player->setMousePosition(input.x, input.y);
+            }
+        }
+        else if (input.command == InputCommand::MOUSE_DOWN) {
+            m_mousePressed = true;
+            
+            // Click on START_SCREEN or GAME_OVER to start countdown directly
+            if (m_gameState == GameState::START_SCREEN || m_gameState == GameState::GAME_OVER) {
+                resetSession(ResetKind::NEW_GAME);
+            }
+        }
+        else if (input.command == InputCommand::MOUSE_UP) {
+            m_mousePressed = false;
+        }
+        else if (input.command == InputCommand::QUICK_SAVE) {
+            m_quickSave.clear();
+            saveState(m_quickSave);
+            SDL_Log("INFO: Quick save (%zu bytes)", m_quickSave.size());
+        }
+        else if (input.command == InputCommand::QUICK_LOAD) {
+            if (!m_quickSave.empty() && restoreState(m_quickSave)) {
+                SDL_Log("INFO: Quick load");
+            }
+        }
+    }
+    m_inputPending.clear();
+}
+
+void Game::setAutopilot(bool enabled) {
+    m_autopilotEnabled = enabled;
+    m_autopilotIdleTimer = 0.0f;
+    m_autopilot.setField(m_windowWidth, m_windowHeight);
+    SDL_Log("INFO: Autopilot %s", enabled ? "enabled" : "disabled");
+}
+
+void Game::applyAutopilot(float deltaTime) {
+    // Title and results screens: start the next game after a short pause
+    if (m_gameState == GameState::START_SCREEN || m_gameState == GameState::GAME_OVER) {
+        m_autopilotIdleTimer += deltaTime;
+        if (m_autopilotIdleTimer >= AUTOPILOT_RESTART_DELAY) {
+            m_autopilotIdleTimer = 0.0f;
+            resetSession(ResetKind::NEW_GAME);
+        }
+        return;
+    }
+    if (m_gameState != GameState::PLAYING) {
+        return;
+    }
+    
+    // Overrides whatever the mouse did this tick
+    Autopilot::Command command = m_autopilot.update(*m_player, m_enemies, m_enemyBullets, m_boss.get(), m_powerUps, m_itemBoxes);
+    m_player->setMousePosition(command.targetX, command.targetY);
+    m_mousePressed = command.fire;
+}
+
+void Game::logStatus() const {
+    SDL_Log("INFO: Status: %.1f min, game %d, stage %d, score %d, lives %d | enemies %zu, bullets %zu + %zu enemy, "
+            "pickups %zu + %zu boxes | pool slots %zu + %zu (%zu + %zu blocks, %zu grown mid-stage), tick arena %zu KB",
+            m_simulationTick / 3600.0f, m_sessionCount, m_currentStage, m_score, m_lives,
+            m_enemies.size(), m_bullets.size(), m_enemyBullets.size(),
+            m_powerUps.size(), m_itemBoxes.size(),
+            m_powerUpPool.getCapacity(), m_itemBoxPool.getCapacity(),
+            m_powerUpPool.getAllocationCount(), m_itemBoxPool.getAllocationCount(), m_poolGrowthBlocks,
+            m_tickArena.getCapacity() / 1024);
+}
+
+void Game::setTuning(const GameTuning& tuning) {
+    m_tuning = tuning;
+    for (int& weight : m_tuning.dropWeights) {
+        weight = std::max(weight, 0);
+    }
+}
+
+void Game::startSession(uint64_t seed) {
+    m_random.reseed(seed);
+    m_mousePressed = false;
+    m_autopilotIdleTimer = 0.0f;
+    resetSession(ResetKind::NEW_GAME);
+}
+
+void Game::startSimulationThread(float stepSeconds) {
+    if (m_simulationRunning) {
+        return;
+    }
+    m_simulationRunning = true;
+    m_simulationThread = std::thread(&Game::simulationLoop, this, stepSeconds);
+    SDL_Log("INFO: Simulation thread started (%.1f Hz)", 1.0f / stepSeconds);
+}
+
+void Game::stopSimulationThread() {
+    if (!m_simulationThread.joinable()) {
+        return;
+    }
+    m_simulationRunning = false;
+    m_simulationThread.join();
+    SDL_Log("INFO: Simulation thread stopped");
+}
+
+void Game::simulationLoop(float stepSeconds) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration step = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(stepSeconds));
+    Clock::time_point nextTick = Clock::now();
+    
+    while (m_simulationRunning) {
+        update(stepSeconds);
+        
+        nextTick += step;
+        Clock::time_point now = Clock::now();
+        if (now > nextTick + step * 4) {
+            nextTick = now;  // Fell far behind (debugger, stall): don't spiral to catch up
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
 void Game::update(float deltaTime) {
+    // Allocation tracking builds: everything a tick allocates is reported under "update"
+    // (the zero budget covers the entity phase of updateSimulation)
+    ALLOCATION_SCOPE("update");
+    
+    // Last tick's scratch is out of scope by now
+    m_tickArena.reset();
+    
+    applyInput();
+    if (m_autopilotEnabled) {
+        applyAutopilot(deltaTime);
+    }
+    updateSimulation(deltaTime);
+    m_simulationTick++;
+    
+    // Headless: nothing to hear or draw
+    if (m_headless) {
+        return;
+    }
+    
+    // Start this tick's sounds (batched, capped, prioritized, placed around the player) and advance music fades
+    if (m_player) {
+        m_soundVoices.setListener(m_player->getX() + m_player->getWidth() / 2, m_player->getY() + m_player->getHeight() / 2);
+    }
+    m_soundVoices.flush(deltaTime);
+    m_music.update(deltaTime);
+    
+    // Publish this tick for the render thread
+    buildSnapshot(m_snapshots.back());
+    m_snapshots.publish();
+}
+
+void Game::updateSimulation(float deltaTime) {
     // Don't update when paused
     if (m_gameState == GameState::PAUSED) {
         return;
@@ -749,18 +1072,27 @@ void Game::update(float deltaTime) {
         if (m_stateTimer <= 0) {
             m_gameState = GameState::PLAYING;
             
-            // Switch from opening music to stage music
-            if (m_stage01Music) {
-                Mix_HaltMusic();
-                Mix_VolumeMusic(64);
-                Mix_PlayMusic(m_stage01Music, -1);
-                SDL_Log("INFO: Game started - Playing stage01.wav");
-            }
+            // Switch from opening music to stage music, boss track loads in the background
+            m_music.play(getStageTrack(m_currentStage), 64, 0.5f);
+            m_music.prepare(getBossTrack(m_currentStage));
+            SDL_Log("INFO: Game started - stage %d music", m_currentStage);
             
             // Item boxes will spawn automatically in space city section
         }
         return;
     }
+    else if (m_gameState == GameState::EXPLODING) {
+        // Explosion frames, plus a short black screen before game over
+        m_explosionTimer += deltaTime;
+        float duration = PLAYER_EXPLOSION_FRAME_TIME * PLAYER_EXPLOSION_FRAMES;
+        if (m_lives <= 0) {
+            duration += 0.2f;
+        }
+        if (m_explosionTimer >= duration) {
+            finishPlayerExplosion();
+        }
+        return;
+    }
     else if (m_gameState == GameState::GAME_OVER) {
         // Do nothing in game over state
         return;
@@ -770,117 +1102,51 @@ void Game::update(float deltaTime) {
     // Background scroll with seamless transitions
     m_backgroundY1 += m_backgroundScrollSpeed * deltaTime;
     m_backgroundY2 += m_backgroundScrollSpeed * deltaTime;
-    int windowHeight;
-    SDL_GetWindowSize(m_window, nullptr, &windowHeight);
-    
-    // Advance to next background in sequence
-    auto advanceSequence = [&]() -> SDL_Texture* {
-        SDL_Texture* textureToUse = m_nextSequenceTexture;
-        
-        // Determine what comes next after this one
-        if (m_boss) {
-            // Boss active: keep looping background 01
-            m_nextSequenceTexture = m_background01Texture;
-        } else if (m_enemyKillCount >= 18) {
-            // Before boss: transition to 04 then 01
-            if (m_bgSequenceIndex == 2) {
-                // From bg03 to bg04
-                m_bgSequenceIndex = 4;
-                m_nextSequenceTexture = m_background04Texture;
-                SDL_Log("INFO: Next background: 04 (Before Boss)");
-            } else if (m_bgSequenceIndex == 4) {
-                // From bg04 to bg01 (boss)
-                m_bgSequenceIndex = 5;
-                m_nextSequenceTexture = m_background01Texture;
-                m_bg04Completed = true;  // Mark bg04 as completed
-                SDL_Log("INFO: Next background: 01 (Boss) - Starting 10s timer");
-            } else if (m_bgSequenceIndex == 5) {
-                // Boss: loop bg01
-                m_nextSequenceTexture = m_background01Texture;
-            }
-        } else {
-            // Normal sequence: 01 -> 02 -> 03 (loop)
-            if (m_bgSequenceIndex == 0) {
-                // After 01 comes 02, prepare 03 next
-                m_bgSequenceIndex = 1;
-                m_nextSequenceTexture = m_background03Texture;
-                SDL_Log("INFO: Next background: 03");
-            } else if (m_bgSequenceIndex == 1) {
-                // After 02 comes 03, keep looping 03
-                m_bgSequenceIndex = 2;
-                m_bg03LoopCount = 0;
-                m_nextSequenceTexture = m_background03Texture;
-                SDL_Log("INFO: Next background: 03 (first loop)");
-            } else if (m_bgSequenceIndex == 2) {
-                // bg03 loops
-                m_bg03LoopCount++;
-                m_nextSequenceTexture = m_background03Texture;
-                SDL_Log("INFO: Next background: 03 (loop %d)", m_bg03LoopCount);
-            }
-        }
-        
-        return textureToUse;
-    };
+    int windowHeight = m_windowHeight;
     
     // When top background scrolls off screen, replace it with next in sequence
     if (m_backgroundY1 >= windowHeight) {
         m_backgroundY1 = m_backgroundY2 - windowHeight;
-        m_bgSlot1Texture = advanceSequence();
+        m_bgSlot1 = m_nextSequenceSprite;
     }
     
     // When bottom background scrolls off screen, replace it with next in sequence
     if (m_backgroundY2 >= windowHeight) {
         m_backgroundY2 = m_backgroundY1 - windowHeight;
-        m_bgSlot2Texture = advanceSequence();
+        m_bgSlot2 = m_nextSequenceSprite;
     }
     
-    // Track space city section and spawn item boxes
-    // Space city is bg02, bg03 (all), and bg04
-    bool wasInSpaceCity = m_inSpaceCity;
-    
-    // Simply check if we're in the space city backgrounds (index 1, 2, or 4)
-    if (m_bgSequenceIndex == 1 || m_bgSequenceIndex == 2 || m_bgSequenceIndex == 4) {
-        m_inSpaceCity = true;
-    } else {
-        m_inSpaceCity = false;
-    }
-    
-    // Log when entering space city
-    if (m_inSpaceCity && !wasInSpaceCity) {
-        SDL_Log("INFO: Entering space city section (index %d)", m_bgSequenceIndex);
-    }
+    // Run stage timeline (waves, backgrounds, item zones, boss trigger)
+    updateStageTimeline(deltaTime);
     
-    // Spawn item boxes periodically in space city
-    if (m_inSpaceCity) {
+    // Spawn item boxes periodically in item zone (space city)
+    if (m_itemZoneActive) {
         m_itemBoxSpawnTimer += deltaTime;
-        if (m_itemBoxSpawnTimer >= 2.0f) {  // Spawn every 2 seconds
-            int windowWidth;
-            SDL_GetWindowSize(m_window, &windowWidth, nullptr);
+        if (m_itemBoxSpawnTimer >= m_itemBoxSpawnInterval) {
+            int windowWidth = m_windowWidth;
             
             // Spawn 2-3 boxes
-            int boxCount = 2 + (rand() % 2);
+            int boxCount = 2 + m_random.nextInt(2);
             for (int i = 0; i < boxCount; i++) {
-                float boxX = 50.0f + (rand() % (windowWidth - 100));
+                float boxX = 50.0f + m_random.nextInt(windowWidth - 100);
                 float boxY = -50.0f - (i * 80.0f);  // Stagger slightly
-                m_itemBoxes.push_back(std::make_unique<ItemBox>(boxX, boxY));
+                m_itemBoxes.push_back(m_itemBoxPool.acquire(boxX, boxY));
             }
             
             SDL_Log("INFO: Spawned %d item boxes (total: %zu)", boxCount, m_itemBoxes.size());
             m_itemBoxSpawnTimer = 0.0f;
         }
-    } else if (wasInSpaceCity && !m_inSpaceCity) {
-        // Just exited space city, reset timer
-        SDL_Log("INFO: Exiting space city section");
-        m_itemBoxSpawnTimer = 0.0f;
     }
     
     // Update player
     m_player->update(deltaTime);
+    m_sessionStats.playTime += deltaTime;
+    m_sessionStats.maxSpeedLevel = std::max(m_sessionStats.maxSpeedLevel, m_player->getSpeedLevel());
+    m_sessionStats.maxLaserLevel = std::max(m_sessionStats.maxLaserLevel, m_player->getLaserLevel());
+    m_sessionStats.maxMissileLevel = std::max(m_sessionStats.maxMissileLevel, m_player->getMissileLevel());
     
     // Check player screen boundaries
-    int windowWidth;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-    m_player->clampToScreen(windowWidth, windowHeight);
+    m_player->clampToScreen(m_windowWidth, m_windowHeight);
     
     // Auto-fire bullets
     if (m_player->canShoot()) {
@@ -909,8 +1175,7 @@ void Game::update(float deltaTime) {
         
         // Play shoot sound
         if (m_shootSound) {
-            Mix_VolumeChunk(m_shootSound, 32);  // Reduce volume (0-128, default 128)
-            Mix_PlayChannel(-1, m_shootSound, 0);
+            m_soundVoices.trigger(SoundId::LASER, m_player->getX() + m_player->getWidth() / 2, m_player->getY());
         } else {
             // Fallback: Windows beep sound
             #ifdef _WIN32
@@ -927,42 +1192,33 @@ void Game::update(float deltaTime) {
         if (missileCount > 5) missileCount = 5;
         
         float playerCenterX = m_player->getX() + m_player->getWidth() / 2;
+        bool homing = m_player->getMissileLevel() >= HOMING_MISSILE_LEVEL;
         
         // Fire missiles based on level
-        if (missileCount == 1) {
-            m_bullets.push_back(std::make_unique<Bullet>(
-                playerCenterX - 7.5f, m_player->getY(), Bullet::Owner::PLAYER, Bullet::BulletType::MISSILE
-            ));
-        } else {
-            float spacing = 30.0f;
-            float startX = playerCenterX - (missileCount - 1) * spacing / 2;
-            for (int i = 0; i < missileCount; i++) {
-                m_bullets.push_back(std::make_unique<Bullet>(
-                    startX + i * spacing - 7.5f, m_player->getY(), Bullet::Owner::PLAYER, Bullet::BulletType::MISSILE
-                ));
-            }
+        float spacing = 30.0f;
+        float startX = playerCenterX - (missileCount - 1) * spacing / 2;
+        for (int i = 0; i < missileCount; i++) {
+            auto missile = std::make_unique<Bullet>(
+                startX + i * spacing - 7.5f, m_player->getY(), Bullet::Owner::PLAYER, Bullet::BulletType::MISSILE
+            );
+            missile->setHoming(homing);
+            m_bullets.push_back(std::move(missile));
         }
         
         m_missileShootTimer = m_missileShootCooldown;  // Reset to 1.0 second
         
         // Play shoot sound (same as laser)
-        if (m_shootSound) {
-            Mix_VolumeChunk(m_shootSound, 32);
-            Mix_PlayChannel(-1, m_shootSound, 0);
-        }
+        m_soundVoices.trigger(SoundId::MISSILE, m_player->getX() + m_player->getWidth() / 2, m_player->getY());
     }
 
-    // Spawn enemies (only if no boss active)
-    if (!m_boss) {
+    // Random enemy spawns (only if enabled by stage script and no boss active)
+    if (!m_boss && m_enemySpawnInterval > 0.0f) {
         m_enemySpawnTimer += deltaTime;
         if (m_enemySpawnTimer >= m_enemySpawnInterval) {
-            int windowWidth, windowHeight;
-            SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-            
-            float enemyX = static_cast<float>(rand() % (windowWidth - 40));
+            float enemyX = static_cast<float>(m_random.nextInt(m_windowWidth - 40));
             
             // Determine enemy type (10% special, 90% random types)
-            int typeRoll = rand() % 100;
+            int typeRoll = m_random.nextInt(100);
             Enemy::EnemyType enemyType;
             bool isSpecial = false;
             
@@ -972,7 +1228,7 @@ void Game::update(float deltaTime) {
                 isSpecial = true;
             } else {
                 // 90% chance: Random type from TYPE_01, 02, 04, 05
-                int typeIndex = rand() % 4;
+                int typeIndex = m_random.nextInt(4);
                 switch (typeIndex) {
                     case 0: enemyType = Enemy::EnemyType::TYPE_01; break;
                     case 1: enemyType = Enemy::EnemyType::TYPE_02; break;
@@ -981,110 +1237,69 @@ void Game::update(float deltaTime) {
                 }
             }
             
-            m_enemies.push_back(std::make_unique<Enemy>(enemyX, -40.0f, enemyType, isSpecial));
+            addEnemy(std::make_unique<Enemy>(enemyX, -40.0f, enemyType, isSpecial));
             m_enemySpawnTimer = 0.0f;
         }
     }
     
-    // Update boss spawn timer after bg04
-    if (m_bg04Completed && !m_boss) {
-        m_bossSpawnTimer += deltaTime;
-        if (m_bossSpawnTimer >= 10.0f) {
-            spawnBoss(m_currentStage);
-            m_enemyKillCount = 0;
-            m_enemies.clear();  // Clear all enemies when boss appears
-            m_bg04Completed = false;  // Reset for next stage
-            m_bossSpawnTimer = 0.0f;
-        }
-    }
-
     // Update boss
     if (m_boss) {
         m_boss->update(deltaTime);
         
-        // Boss shoots occasionally
-        if (m_boss->canShoot() && m_boss->getState() == Boss::BossState::FIGHTING) {
-            // Boss shoots from 12 cannon positions
-            const Boss::CannonPos* cannons = m_boss->getCannonPositions();
-            int cannonCount = m_boss->getCannonCount();
-            
-            for (int i = 0; i < cannonCount; i++) {
-                float cannonX = m_boss->getX() + cannons[i].offsetX;
-                float cannonY = m_boss->getY() + cannons[i].offsetY;
-                
-                m_enemyBullets.push_back(std::make_unique<Bullet>(
-                    cannonX, cannonY, Bullet::Owner::ENEMY
-                ));
-            }
-            
-            m_boss->resetShootTimer();
+        // Boss cannons fire the scripted patterns for this stage
+        if (m_boss->getState() == Boss::BossState::FIGHTING) {
+            float targetX = m_player->getX() + m_player->getWidth() / 2;
+            float targetY = m_player->getY() + m_player->getHeight() / 2;
+            m_bossPattern.update(deltaTime, *m_boss, targetX, targetY, m_enemyBullets);
         }
         
         // Remove boss if dead
         if (m_boss->isOffScreen()) {
             m_boss.reset();
+            m_bossPattern.stop();
             m_currentStage++;
+            m_sessionStats.bossesDefeated++;
             
-            // Resume stage music based on current stage
-            Mix_HaltMusic();
-            Mix_Music* stageMusic = nullptr;
-            if (m_currentStage == 1 && m_stage01Music) {
-                stageMusic = m_stage01Music;
-            } else if (m_currentStage == 2 && m_stage02Music) {
-                stageMusic = m_stage02Music;
-            } else if (m_bgMusic) {
-                stageMusic = m_bgMusic;  // Fallback to default music
-            }
+            // Next stage: restart the timeline from the top
+            loadStageScript(m_currentStage);
             
-            if (stageMusic) {
-                Mix_VolumeMusic(64);
-                Mix_PlayMusic(stageMusic, -1);
-            }
+            // Back to stage music after a short pause
+            m_music.play(getStageTrack(m_currentStage), 64, 2.0f, 1.0f);
+            m_music.prepare(getBossTrack(m_currentStage));
         }
     }
 
-    // Update enemies
+    // From here on (entity updates, collisions, cleanup) a tick must not allocate:
+    // scratch buffers are reserved and pickups come from pools. Spawning and firing
+    // above still allocate (player bullets and enemies are heap objects, their vectors
+    // grow to a new peak, a boss kill reloads the stage script).
+    ALLOCATION_BUDGET("entities", 0);
+    
+    // Update enemies in parallel chunks (movement + shooting); shots are queued per thread
     float playerCenterX = m_player->getX() + m_player->getWidth() / 2;
-    for (auto& enemy : m_enemies) {
-        enemy->update(deltaTime, playerCenterX);
-        
-        // Enemy shoots occasionally
-        if (enemy->canShoot()) {
-            float enemyCenterX = enemy->getX() + enemy->getWidth() / 2;
-            float enemyBottomY = enemy->getY() + enemy->getHeight();
-            
-            // TYPE_05: Burst shooting (3 bullets)
-            if (enemy->getType() == Enemy::EnemyType::TYPE_05 && enemy->getBurstCount() > 0) {
-                m_enemyBullets.push_back(std::make_unique<Bullet>(
-                    enemyCenterX, enemyBottomY, Bullet::Owner::ENEMY
-                ));
-                enemy->decreaseBurstCount();
-                
-                // Continue burst (0.2s delay between bullets)
-                if (enemy->getBurstCount() > 0) {
-                    enemy->resetShootTimer();
-                    // Short delay for burst
-                    // Note: This is handled in Enemy class with resetShootTimer
-                }
-            } else {
-                // Normal shooting for other types
-                m_enemyBullets.push_back(std::make_unique<Bullet>(
-                    enemyCenterX, enemyBottomY, Bullet::Owner::ENEMY
-                ));
-                enemy->resetShootTimer();
-            }
-        }
-    }
+    m_jobs.parallelFor(m_enemies.size(), ENEMY_JOB_GRAIN, [&](size_t begin, size_t end, unsigned thread) {
+        updateEnemyRange(begin, end, deltaTime, playerCenterX, m_workerCommands[thread]);
+    });
+    mergeWorkerCommands();
     
     // Update enemy bullets
-    for (auto& bullet : m_enemyBullets) {
-        bullet->update(deltaTime);
-    }
+    m_jobs.parallelFor(m_enemyBullets.size(), BULLET_JOB_GRAIN, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            m_enemyBullets[i].update(deltaTime);
+        }
+    });
 
-    // Update bullets
-    for (auto& bullet : m_bullets) {
-        bullet->update(deltaTime);
-    }
+    // Update bullets (homing missiles pick their target first)
+    bool homingMissiles = buildMissileTargets();
+    m_jobs.parallelFor(m_bullets.size(), BULLET_JOB_GRAIN, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            Bullet& bullet = *m_bullets[i];
+            if (homingMissiles && bullet.isHoming()) {
+                aimMissile(bullet);
+            }
+            bullet.update(deltaTime);
+        }
+    });
 
     // Remove enemies that went off screen
     m_enemies.erase(
@@ -1099,110 +1314,44 @@ void Game::update(float deltaTime) {
     m_bullets.erase(
         std::remove_if(m_bullets.begin(), m_bullets.end(),
             [this](const std::unique_ptr<Bullet>& bullet) {
-                return bullet->isOffScreen(getWindowHeight());
+                return bullet->isOffScreen(m_windowWidth, m_windowHeight);  // Homing missiles can leave sideways
             }),
         m_bullets.end()
     );
     
-    // Remove enemy bullets that went off screen
-    m_enemyBullets.erase(
-        std::remove_if(m_enemyBullets.begin(), m_enemyBullets.end(),
-            [this](const std::unique_ptr<Bullet>& bullet) {
-                return bullet->isOffScreen(getWindowHeight());
-            }),
-        m_enemyBullets.end()
-    );
-    
-    // Remove enemy bullets that went off screen
-    m_enemyBullets.erase(
-        std::remove_if(m_enemyBullets.begin(), m_enemyBullets.end(),
-            [this](const std::unique_ptr<Bullet>& bullet) {
-                return bullet->isOffScreen(getWindowHeight());
-            }),
-        m_enemyBullets.end()
-    );
+    // Remove enemy bullets that went off screen (pattern bullets can also leave sideways)
+    m_enemyBullets.removeOffScreen(m_windowWidth, m_windowHeight);
 
-    // Collision detection (simple AABB)
-    for (auto bulletIt = m_bullets.begin(); bulletIt != m_bullets.end();) {
-        bool bulletRemoved = false;
-        
-        if ((*bulletIt)->getOwner() == Bullet::Owner::PLAYER) {
-            // Missiles cannot destroy flying enemies (only ground objects in future)
-            if ((*bulletIt)->getType() == Bullet::BulletType::MISSILE) {
-                ++bulletIt;
-                continue;
-            }
-            
-            // Only lasers can destroy enemies
-            for (auto enemyIt = m_enemies.begin(); enemyIt != m_enemies.end();) {
-                // Check collision
-                if ((*bulletIt)->getX() < (*enemyIt)->getX() + (*enemyIt)->getWidth() &&
-                    (*bulletIt)->getX() + (*bulletIt)->getWidth() > (*enemyIt)->getX() &&
-                    (*bulletIt)->getY() < (*enemyIt)->getY() + (*enemyIt)->getHeight() &&
-                    (*bulletIt)->getY() + (*bulletIt)->getHeight() > (*enemyIt)->getY()) {
-                    
-                    // Check if special enemy - drop power-up
-                    bool wasSpecial = (*enemyIt)->isSpecial();
-                    float enemyX = (*enemyIt)->getX();
-                    float enemyY = (*enemyIt)->getY();
-                    
-                    // Collision occurred: remove both and increase score
-                    m_score += wasSpecial ? 50 : 10;
-                    if (m_score > m_highScore) {
-                        m_highScore = m_score;
-                    }
-                    
-                    // Increment enemy kill count
-                    m_enemyKillCount++;
-                    
-                    // Play explosion sound
-                    if (m_explosionSound) {
-                        Mix_PlayChannel(-1, m_explosionSound, 0);
-                    }
-                    
-                    // Drop power-up if special
-                    if (wasSpecial) {
-                        dropPowerUp(enemyX + (*enemyIt)->getWidth() / 2, enemyY);
-                    }
-                    
-                    enemyIt = m_enemies.erase(enemyIt);
-                    bulletIt = m_bullets.erase(bulletIt);
-                    bulletRemoved = true;
-                    break;
-                } else {
-                    ++enemyIt;
-                }
-            }
-        }
-        
-        if (!bulletRemoved) {
-            ++bulletIt;
-        }
-    }
+    // Laser vs enemy collision
+    checkLaserEnemyCollision();
     
     // Update power-ups
-    for (auto& powerUp : m_powerUps) {
-        powerUp->update(deltaTime);
-    }
+    m_jobs.parallelFor(m_powerUps.size(), BULLET_JOB_GRAIN, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            m_powerUps[i]->update(deltaTime);
+        }
+    });
     
     // Remove power-ups that went off screen
     m_powerUps.erase(
         std::remove_if(m_powerUps.begin(), m_powerUps.end(),
-            [](const std::unique_ptr<PowerUp>& powerUp) {
+            [](const ObjectPool<PowerUp>::Ptr& powerUp) {
                 return powerUp->isOffScreen();
             }),
         m_powerUps.end()
     );
     
     // Update item boxes
-    for (auto& itemBox : m_itemBoxes) {
-        itemBox->update(deltaTime);
-    }
+    m_jobs.parallelFor(m_itemBoxes.size(), BULLET_JOB_GRAIN, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            m_itemBoxes[i]->update(deltaTime);
+        }
+    });
     
     // Remove item boxes that went off screen
     m_itemBoxes.erase(
         std::remove_if(m_itemBoxes.begin(), m_itemBoxes.end(),
-            [](const std::unique_ptr<ItemBox>& box) {
+            [](const ObjectPool<ItemBox>::Ptr& box) {
                 return box->isOffScreen();
             }),
         m_itemBoxes.end()
@@ -1217,6 +1366,11 @@ void Game::update(float deltaTime) {
     // Check player-boss collision
     checkPlayerBossCollision();
     
+    // Player was hit: the world freezes for the explosion
+    if (m_gameState == GameState::EXPLODING) {
+        return;
+    }
+    
     // Check boss-bullet collision
     checkBossBulletCollision();
     
@@ -1260,17 +1414,18 @@ void Game::checkPlayerEnemyCollision() {
 }
 
 void Game::checkPlayerEnemyBulletCollision() {
-    for (auto bulletIt = m_enemyBullets.begin(); bulletIt != m_enemyBullets.end();) {
-        // Use hitbox instead of full sprite for more accurate collision
-        float playerLeft = m_player->getHitboxX();
-        float playerRight = playerLeft + m_player->getHitboxWidth();
-        float playerTop = m_player->getHitboxY();
-        float playerBottom = playerTop + m_player->getHitboxHeight();
-        
-        float bulletLeft = (*bulletIt)->getX();
-        float bulletRight = bulletLeft + (*bulletIt)->getWidth();
-        float bulletTop = (*bulletIt)->getY();
-        float bulletBottom = bulletTop + (*bulletIt)->getHeight();
+    // Use hitbox instead of full sprite for more accurate collision
+    float playerLeft = m_player->getHitboxX();
+    float playerRight = playerLeft + m_player->getHitboxWidth();
+    float playerTop = m_player->getHitboxY();
+    float playerBottom = playerTop + m_player->getHitboxHeight();
+    
+    for (size_t i = 0; i < m_enemyBullets.size();) {
+        const Bullet& bullet = m_enemyBullets[i];
+        float bulletLeft = bullet.getX();
+        float bulletRight = bulletLeft + bullet.getWidth();
+        float bulletTop = bullet.getY();
+        float bulletBottom = bulletTop + bullet.getHeight();
         
         // Check collision between hitboxes
         if (playerLeft < bulletRight &&
@@ -1278,8 +1433,8 @@ void Game::checkPlayerEnemyBulletCollision() {
             playerTop < bulletBottom &&
             playerBottom > bulletTop) {
             
-            // Remove bullet
-            bulletIt = m_enemyBullets.erase(bulletIt);
+            // Remove bullet (slot i now holds another bullet, so don't advance)
+            m_enemyBullets.release(i);
             
             // Damage player (-1 energy)
             if (m_player->takeDamage(1)) {
@@ -1288,93 +1443,229 @@ void Game::checkPlayerEnemyBulletCollision() {
                 return;
             }
         } else {
-            ++bulletIt;
+            ++i;
         }
     }
 }
 
 void Game::damagePlayer() {
+    // Already exploding (several hits in the same tick)
+    if (m_gameState == GameState::EXPLODING) {
+        return;
+    }
+    
     m_lives--;
+    m_sessionStats.livesLost++;
     
-    // Show explosion animation (boom01-06) with sound
-    SDL_Texture* boomFrames[] = {m_boom01Texture, m_boom02Texture, m_boom03Texture, m_boom04Texture, m_boom05Texture, m_boom06Texture};
-            float playerCenterX = m_player->getX() + m_player->getWidth() / 2;
-            float playerCenterY = m_player->getY() + m_player->getHeight() / 2;
-            
-            // Play explosion sound at the start of animation
-            if (m_explosionSound) {
-                Mix_PlayChannel(-1, m_explosionSound, 0);
+    // Explosion animation (boom01-06) runs as its own state, centered on the player
+    m_explosionX = m_player->getX() + m_player->getWidth() / 2;
+    m_explosionY = m_player->getY() + m_player->getHeight() / 2;
+    m_explosionTimer = 0.0f;
+    m_gameState = GameState::EXPLODING;
+    
+    // Play explosion sound at the start of animation
+    if (m_explosionSound) {
+        m_soundVoices.trigger(SoundId::PLAYER_DEATH, m_explosionX, m_explosionY);
+    } else {
+        // Fallback: Windows beep sound
+        #ifdef _WIN32
+        Beep(300, 200);
+        #endif
+    }
+}
+
+void Game::finishPlayerExplosion() {
+    // If lives reach 0, game over
+    if (m_lives <= 0) {
+        // Save high score
+        addHighScore(m_score);
+        
+        // Transition to game over state
+        resetSession(ResetKind::GAME_OVER);
+    }
+    else {
+        // If lives remain, restart after countdown
+        resetSession(ResetKind::RESPAWN);
+    }
+}
+
+void Game::resetSession(ResetKind kind) {
+    // Everything here reuses what is already allocated: pools take their slots back,
+    // containers keep their capacity, the player is reset in place and assets stay loaded
+    checkPoolAllocations();
+    m_enemies.clear();
+    m_bullets.clear();
+    m_enemyBullets.clear();
+    m_powerUps.clear();
+    m_itemBoxes.clear();
+    m_missileShootTimer = 0.0f;
+    
+    if (kind != ResetKind::RESPAWN) {
+        m_boss.reset();
+        m_bossPattern.stop();
+    }
+    
+    if (kind == ResetKind::GAME_OVER) {
+        m_gameState = GameState::GAME_OVER;
+        return;
+    }
+    
+    float playerX = m_windowWidth / 2.0f;
+    float playerY = m_windowHeight - 80.0f;
+    if (kind == ResetKind::RESPAWN) {
+        m_player->respawn(playerX, playerY);  // Power-ups kept per Keep flags
+    } else {
+        *m_player = Player(playerX, playerY);
+        m_sessionCount++;
+        m_sessionStats = SessionStats();
+        m_sessionStats.killsToFirstBoss = -1;
+        m_lives = 3;
+        m_score = 0;
+        m_enemyKillCount = 0;
+        
+        // Stage 1 from the top; the script is only parsed again if another stage was loaded
+        if (m_currentStage != 1) {
+            m_currentStage = 1;
+            loadStageScript(m_currentStage);
+        } else {
+            m_stageScript.restart();
+            m_stageTime = 0.0f;
+        }
+        m_enemySpawnTimer = 0.0f;
+        m_enemySpawnInterval = 0.0f;
+        m_itemZoneActive = false;
+        m_itemBoxSpawnTimer = 0.0f;
+        
+        // Background sequence back to its start
+        m_bgSlot1 = SpriteId::BACKGROUND_01;
+        m_bgSlot2 = SpriteId::BACKGROUND_01;
+        m_nextSequenceSprite = SpriteId::BACKGROUND_01;
+        m_backgroundY1 = 0.0f;
+        m_backgroundY2 = -static_cast<float>(m_windowHeight);  // One window height above, as in init()
+    }
+    
+    m_gameState = GameState::COUNTDOWN;
+    m_stateTimer = 2.0f;  // 2 seconds: 1s GET READY, 1s GO
+}
+
+template <typename Visitor>
+void Game::visitSimulationValues(Visitor&& visit) {
+    // Plain values in a fixed order; entities are handled by saveState/restoreState
+    visit(m_simulationTick);
+    visit(m_random);
+    visit(m_gameState);
+    visit(m_stateTimer);
+    visit(m_explosionTimer);
+    visit(m_explosionX);
+    visit(m_explosionY);
+    visit(m_lives);
+    visit(m_score);
+    visit(m_highScore);
+    visit(m_enemySpawnTimer);
+    visit(m_enemySpawnInterval);
+    visit(m_enemyKillCount);
+    visit(m_sessionStats);
+    visit(m_currentStage);
+    visit(m_stageTime);
+    visit(m_bgSlot1);
+    visit(m_bgSlot2);
+    visit(m_backgroundY1);
+    visit(m_backgroundY2);
+    visit(m_nextSequenceSprite);
+    visit(m_itemBoxSpawnTimer);
+    visit(m_itemBoxSpawnInterval);
+    visit(m_itemZoneActive);
+    visit(m_missileShootTimer);
+    visit(m_mousePressed);
+    visit(m_blinkTimer);
+    visit(m_fadeAlpha);
+}
+
+void Game::saveState(std::vector<uint8_t>& out) const {
+    size_t start = out.size();
+    StateWriter writer(out);
+    StateHeader header = {STATE_MAGIC, STATE_VERSION, 0, {}};
+    getStateObjectSizes(header.objectSizes);
+    writer.write(header);
+    
+    // Only reads; the visitor is shared with restoreState so both sides stay in step
+    const_cast<Game*>(this)->visitSimulationValues([&writer](const auto& value) { writer.write(value); });
+    writer.write(static_cast<uint64_t>(m_stageScript.getCursor()));
+    
+    writer.write(*m_player);
+    uint8_t hasBoss = m_boss ? 1 : 0;
+    writer.write(hasBoss);
+    if (m_boss) {
+        writer.write(*m_boss);
+    }
+    m_bossPattern.saveState(writer);
+    writeEntities(writer, m_enemies);
+    writeEntities(writer, m_bullets);
+    m_enemyBullets.saveState(writer);
+    writeEntities(writer, m_powerUps);
+    writeEntities(writer, m_itemBoxes);
+    
+    uint32_t size = static_cast<uint32_t>(out.size() - start);
+    std::memcpy(out.data() + start + offsetof(StateHeader, size), &size, sizeof(size));
+}
+
+bool Game::restoreState(const std::vector<uint8_t>& data) {
+    // Reject anything this build did not write before touching the game
+    StateReader reader(data.data(), data.size());
+    StateHeader header;
+    StateHeader expected = {STATE_MAGIC, STATE_VERSION, static_cast<uint32_t>(data.size()), {}};
+    getStateObjectSizes(expected.objectSizes);
+    if (!reader.read(header) || std::memcmp(&header, &expected, sizeof(StateHeader)) != 0) {
+        SDL_Log("WARNING: Snapshot rejected (different build or truncated)");
+        return false;
+    }
+    
+    int loadedStage = m_currentStage;
+    visitSimulationValues([&reader](auto& value) { reader.read(value); });
+    uint64_t cursor = 0;
+    reader.read(cursor);
+    if (m_currentStage != loadedStage) {
+        loadStageScript(m_currentStage);
+    }
+    m_stageScript.seek(static_cast<size_t>(cursor));
+    
+    reader.read(*m_player);
+    uint8_t hasBoss = 0;
+    reader.read(hasBoss);
+    if (hasBoss) {
+        alignas(Boss) unsigned char storage[sizeof(Boss)];
+        if (const Boss* boss = reader.readObject<Boss>(storage)) {
+            if (m_boss) {
+                *m_boss = *boss;
             } else {
-                // Fallback: Windows beep sound
-                #ifdef _WIN32
-                Beep(300, 200);
-                #endif
-            }
-            
-            for (int i = 0; i < 6; i++) {
-                if (boomFrames[i]) {
-                    // Clear screen
-                    SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
-                    SDL_RenderClear(m_renderer);
-                    
-                    // Draw background using slot system
-                    SDL_Texture* bg1Texture = m_bgSlot1Texture ? m_bgSlot1Texture : m_backgroundTexture;
-                    SDL_Texture* bg2Texture = m_bgSlot2Texture ? m_bgSlot2Texture : m_backgroundTexture;
-                    
-                    if (bg1Texture && bg2Texture) {
-                        int windowWidth, windowHeight;
-                        SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                        SDL_Rect bg1 = {0, static_cast<int>(m_backgroundY1), windowWidth, windowHeight};
-                        SDL_Rect bg2 = {0, static_cast<int>(m_backgroundY2), windowWidth, windowHeight};
-                        SDL_RenderCopy(m_renderer, bg1Texture, nullptr, &bg1);
-                        SDL_RenderCopy(m_renderer, bg2Texture, nullptr, &bg2);
-                    }
-                    
-                    // Draw explosion frame centered on player
-                    int boomSize = 80;  // Match player size
-                    SDL_Rect boomRect = {
-                        static_cast<int>(playerCenterX - boomSize / 2),
-                        static_cast<int>(playerCenterY - boomSize / 2),
-                        boomSize,
-                        boomSize
-                    };
-                    SDL_RenderCopy(m_renderer, boomFrames[i], nullptr, &boomRect);
-                    
-                    SDL_RenderPresent(m_renderer);
-                    SDL_Delay(100); // 0.1 second per frame
-                }
-            }
-            
-            // If lives reach 0, game over
-            if (m_lives <= 0) {
-                // Clear screen to black
-                SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
-                SDL_RenderClear(m_renderer);
-                SDL_RenderPresent(m_renderer);
-                SDL_Delay(200); // Wait 0.2 seconds
-                
-                // Save high score
-                addHighScore(m_score);
-                
-                // Transition to game over state
-                m_gameState = GameState::GAME_OVER;
-                m_enemies.clear();
-                m_bullets.clear();
-                m_enemyBullets.clear();
-            }
-            else {
-                // If lives remain, restart after countdown
-                m_gameState = GameState::COUNTDOWN;
-                m_stateTimer = 2.0f; // 2 seconds: 1s GET READY, 1s GO
-                m_enemies.clear();
-                m_bullets.clear();
-                m_enemyBullets.clear();
-                m_powerUps.clear();
-                int windowWidth, windowHeight;
-                SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-                m_player = std::make_unique<Player>(windowWidth / 2.0f, windowHeight - 80.0f);
-                m_player->resetOnDeath(); // Reset power-ups based on Keep flags
+                m_boss = std::make_unique<Boss>(*boss);
             }
+        }
+    } else {
+        m_boss.reset();
+    }
+    m_bossPattern.loadState(reader);
+    readEntities(reader, m_enemies, [](const Enemy& enemy) { return std::make_unique<Enemy>(enemy); });
+    readEntities(reader, m_bullets, [](const Bullet& bullet) { return std::make_unique<Bullet>(bullet); });
+    m_enemyBullets.loadState(reader);
+    readEntities(reader, m_powerUps, [this](const PowerUp& powerUp) { return m_powerUpPool.acquire(powerUp); });
+    readEntities(reader, m_itemBoxes, [this](const ItemBox& box) { return m_itemBoxPool.acquire(box); });
+    m_stagePoolBlocks = m_powerUpPool.getAllocationCount() + m_itemBoxPool.getAllocationCount();  // A snapshot may hold more
+    
+    if (!reader.isFinished()) {
+        // Header matched, so this only happens if save and restore disagree
+        SDL_Log("WARNING: Snapshot did not restore cleanly, starting over");
+        resetSession(ResetKind::NEW_GAME);
+        return false;
+    }
+    
+    // Sounds from the abandoned timeline stop; music follows the restored stage
+    m_soundVoices.stopAll();
+    if (m_gameState != GameState::START_SCREEN && m_gameState != GameState::MENU) {
+        m_music.play(m_boss ? getBossTrack(m_currentStage) : getStageTrack(m_currentStage),
+                     m_boss ? MIX_MAX_VOLUME : 64, 0.5f);
+    }
+    return true;
 }
 
 void Game::checkPlayerBossCollision() {
@@ -1403,260 +1694,578 @@ void Game::checkPlayerBossCollision() {
 }
 
 void Game::checkBossBulletCollision() {
-    if (!m_boss || m_boss->getState() != Boss::BossState::FIGHTING) {
+    if (!m_boss || m_boss->getState() != Boss::BossState::FIGHTING || m_bullets.empty()) {
         return;
     }
     
-    for (auto bulletIt = m_bullets.begin(); bulletIt != m_bullets.end();) {
-        bool bulletRemoved = false;
-        
-        if ((*bulletIt)->getOwner() == Bullet::Owner::PLAYER) {
-            int damage = 1;
-            bool hitBoss = false;
-            
-            // Check weak point first (front center) - 5x damage
-            float weakX = m_boss->getWeakPointX();
-            float weakY = m_boss->getWeakPointY();
-            float weakW = m_boss->getWeakPointWidth();
-            float weakH = m_boss->getWeakPointHeight();
-            
-            if ((*bulletIt)->getX() < weakX + weakW &&
-                (*bulletIt)->getX() + (*bulletIt)->getWidth() > weakX &&
-                (*bulletIt)->getY() < weakY + weakH &&
-                (*bulletIt)->getY() + (*bulletIt)->getHeight() > weakY) {
-                
-                // Hit weak point: 5x damage
-                damage = 5;
-                hitBoss = true;
+    m_bulletGrid.build(m_bullets.size(), [this](size_t i, Aabb& box) {
+        const Bullet& bullet = *m_bullets[i];
+        box = {bullet.getX(), bullet.getY(), bullet.getWidth(), bullet.getHeight()};
+        return bullet.getOwner() == Bullet::Owner::PLAYER;
+    });
+    
+    // Weak point (front center) lies inside the body hitbox, so every hit overlaps the hitbox
+    Aabb hitbox = {m_boss->getHitboxX(), m_boss->getHitboxY(), m_boss->getHitboxWidth(), m_boss->getHitboxHeight()};
+    Aabb weakPoint = {m_boss->getWeakPointX(), m_boss->getWeakPointY(), m_boss->getWeakPointWidth(), m_boss->getWeakPointHeight()};
+    
+    // Narrowphase over the cells under the boss
+    int minColumn, minRow, maxColumn, maxRow;
+    m_bulletGrid.getCellRange(hitbox, minColumn, minRow, maxColumn, maxRow);
+    int spanColumns = maxColumn - minColumn + 1;
+    size_t cellCount = static_cast<size_t>(spanColumns) * (maxRow - minRow + 1);
+    m_jobs.parallelFor(cellCount, COLLISION_CELL_GRAIN, [&](size_t begin, size_t end, unsigned thread) {
+        std::vector<Contact>& contacts = m_threadContacts[thread];
+        for (size_t k = begin; k < end; k++) {
+            int cell = (minRow + static_cast<int>(k) / spanColumns) * m_bulletGrid.getColumns() +
+                       minColumn + static_cast<int>(k) % spanColumns;
+            for (const uint32_t* bullet = m_bulletGrid.cellBegin(cell); bullet != m_bulletGrid.cellEnd(cell); ++bullet) {
+                const Aabb& box = m_bulletGrid.getBox(*bullet);
+                if (SpatialGrid::overlaps(box, hitbox) && m_bulletGrid.ownsPair(cell, box, hitbox)) {
+                    // Weak point hits (b = 1) do more damage
+                    bool weak = SpatialGrid::overlaps(box, weakPoint);
+                    int damage = weak ? m_tuning.weakPointDamage : m_tuning.bossHitDamage;
+                    contacts.push_back({*bullet, weak ? 1u : 0u, damage});
+                }
             }
-            // Check collision with boss body (normal hitbox)
-            else if ((*bulletIt)->getX() < m_boss->getHitboxX() + m_boss->getHitboxWidth() &&
-                     (*bulletIt)->getX() + (*bulletIt)->getWidth() > m_boss->getHitboxX() &&
-                     (*bulletIt)->getY() < m_boss->getHitboxY() + m_boss->getHitboxHeight() &&
-                     (*bulletIt)->getY() + (*bulletIt)->getHeight() > m_boss->getHitboxY()) {
-                
-                // Normal damage
-                damage = 1;
-                hitBoss = true;
+        }
+    });
+    std::pmr::vector<Contact> contacts(&m_tickArena);
+    mergeContacts(contacts);
+    
+    // Apply hits in bullet order
+    std::pmr::vector<uint8_t> bulletRemoved(m_bullets.size(), 0, &m_tickArena);
+    for (const Contact& contact : contacts) {
+        int damage = contact.value;
+        m_boss->takeDamage(damage);
+        m_soundVoices.trigger(SoundId::BOSS_HIT, m_boss->getX() + m_boss->getWidth() / 2, m_boss->getY() + m_boss->getHeight() / 2);
+        
+        // Add score
+        if (m_boss->getHealth() <= 0) {
+            m_score += 1000;  // Big bonus for defeating boss
+        } else {
+            m_score += contact.b ? 25 : 5;  // More score for weak point hit
+        }
+        
+        if (m_score > m_highScore) {
+            m_highScore = m_score;
+        }
+        
+        bulletRemoved[contact.a] = 1;
+    }
+    removeFlagged(m_bullets, bulletRemoved);
+}
+
+void Game::checkLaserEnemyCollision() {
+    if (m_bullets.empty() || m_enemies.empty()) {
+        return;
+    }
+    
+    // Only lasers can destroy enemies (missiles are for ground objects)
+    m_bulletGrid.build(m_bullets.size(), [this](size_t i, Aabb& box) {
+        const Bullet& bullet = *m_bullets[i];
+        box = {bullet.getX(), bullet.getY(), bullet.getWidth(), bullet.getHeight()};
+        return bullet.getOwner() == Bullet::Owner::PLAYER && bullet.getType() != Bullet::BulletType::MISSILE;
+    });
+    m_enemyGrid.build(m_enemies.size(), [this](size_t i, Aabb& box) {
+        const Enemy& enemy = *m_enemies[i];
+        box = {enemy.getX(), enemy.getY(), enemy.getWidth(), enemy.getHeight()};
+        return true;
+    });
+    
+    // Narrowphase per cell, contacts collected per job thread
+    m_jobs.parallelFor(m_bulletGrid.getCellCount(), COLLISION_CELL_GRAIN, [this](size_t begin, size_t end, unsigned thread) {
+        std::vector<Contact>& contacts = m_threadContacts[thread];
+        for (int cell = static_cast<int>(begin); cell < static_cast<int>(end); cell++) {
+            const uint32_t* enemiesBegin = m_enemyGrid.cellBegin(cell);
+            const uint32_t* enemiesEnd = m_enemyGrid.cellEnd(cell);
+            if (enemiesBegin == enemiesEnd) {
+                continue;
             }
-            
-            if (hitBoss) {
-                // Damage boss
-                m_boss->takeDamage(damage);
-                
-                // Add score
-                if (m_boss->getHealth() <= 0) {
-                    m_score += 1000;  // Big bonus for defeating boss
-                } else {
-                    m_score += (damage == 5) ? 25 : 5;  // More score for weak point hit
-                }
-                
-                if (m_score > m_highScore) {
-                    m_highScore = m_score;
+            for (const uint32_t* bullet = m_bulletGrid.cellBegin(cell); bullet != m_bulletGrid.cellEnd(cell); ++bullet) {
+                const Aabb& bulletBox = m_bulletGrid.getBox(*bullet);
+                for (const uint32_t* enemy = enemiesBegin; enemy != enemiesEnd; ++enemy) {
+                    const Aabb& enemyBox = m_enemyGrid.getBox(*enemy);
+                    if (SpatialGrid::overlaps(bulletBox, enemyBox) && m_bulletGrid.ownsPair(cell, bulletBox, enemyBox)) {
+                        contacts.push_back({*bullet, *enemy, 0});
+                    }
                 }
-                
-                bulletIt = m_bullets.erase(bulletIt);
-                bulletRemoved = true;
             }
         }
+    });
+    std::pmr::vector<Contact> contacts(&m_tickArena);
+    mergeContacts(contacts);
+    
+    // Resolve in (bullet, enemy) order: each laser takes out the first live enemy it touches
+    std::pmr::vector<uint8_t> bulletRemoved(m_bullets.size(), 0, &m_tickArena);
+    std::pmr::vector<uint8_t> enemyRemoved(m_enemies.size(), 0, &m_tickArena);
+    for (const Contact& contact : contacts) {
+        if (bulletRemoved[contact.a] || enemyRemoved[contact.b]) {
+            continue;
+        }
+        const Enemy& enemy = *m_enemies[contact.b];
         
-        if (!bulletRemoved) {
-            ++bulletIt;
+        // Check if special enemy - drop power-up
+        bool wasSpecial = enemy.isSpecial();
+        
+        // Collision occurred: remove both and increase score
+        m_score += wasSpecial ? 50 : 10;
+        if (m_score > m_highScore) {
+            m_highScore = m_score;
+        }
+        
+        // Increment enemy kill count
+        m_enemyKillCount++;
+        m_sessionStats.kills++;
+        
+        // Play explosion sound
+        m_soundVoices.trigger(SoundId::ENEMY_EXPLOSION, enemy.getX() + enemy.getWidth() / 2, enemy.getY() + enemy.getHeight() / 2);
+        
+        // Drop power-up if special
+        if (wasSpecial) {
+            dropPowerUp(enemy.getX() + enemy.getWidth() / 2, enemy.getY());
+        }
+        
+        bulletRemoved[contact.a] = 1;
+        enemyRemoved[contact.b] = 1;
+    }
+    removeFlagged(m_bullets, bulletRemoved);
+    removeFlagged(m_enemies, enemyRemoved);
+}
+
+void Game::mergeContacts(std::pmr::vector<Contact>& merged) {
+    merged.clear();
+    for (std::vector<Contact>& contacts : m_threadContacts) {
+        merged.insert(merged.end(), contacts.begin(), contacts.end());
+        contacts.clear();
+    }
+    
+    // Same order as the serial nested loops, whatever thread found each pair
+    std::sort(merged.begin(), merged.end(), [](const Contact& x, const Contact& y) {
+        return x.a != y.a ? x.a < y.a : x.b < y.b;
+    });
+}
+
+void Game::spawnBoss(int stage) {
+    float bossX = m_windowWidth / 2.0f - 120.0f;  // Center horizontally (boss is 240 wide)
+    float bossY = -250.0f;  // Start above screen
+    
+    m_boss = std::make_unique<Boss>(bossX, bossY, stage);
+    if (m_tuning.bossHealthScale != 1.0f) {
+        m_boss->setMaxHealth(std::max(1, static_cast<int>(std::lround(m_boss->getMaxHealth() * m_tuning.bossHealthScale))));
+    }
+    m_bossPattern.start(getBossScript(stage));
+    if (m_sessionStats.killsToFirstBoss < 0) {
+        m_sessionStats.killsToFirstBoss = m_sessionStats.kills;
+        m_sessionStats.timeToFirstBoss = m_sessionStats.playTime;
+    }
+    
+    // Crossfade to the boss track (loaded since the stage started), prefetch the next stage
+    m_music.play(getBossTrack(stage), MIX_MAX_VOLUME, 1.0f);
+    m_music.prepare(getStageTrack(stage + 1));
+    SDL_Log("INFO: Boss Stage %d spawned! Playing boss%02d music.", stage, ((stage - 1) % 4) + 1);
+}
+
+SDL_Surface* Game::loadImage(const std::string& path) {
+    // Archive images are pre-decoded; the surface borrows the mapped pixels
+    if (SDL_Surface* surface = m_assets.createSurface(path)) {
+        return surface;
+    }
+    return IMG_Load(path.c_str());
+}
+
+Mix_Chunk* Game::loadSound(const std::string& path) {
+    if (Mix_Chunk* chunk = m_audioCache.loadChunk(path)) {
+        return chunk;
+    }
+    if (SDL_RWops* rw = m_assets.openRW(path)) {
+        return Mix_LoadWAV_RW(rw, 1);
+    }
+    return Mix_LoadWAV(path.c_str());
+}
+
+void Game::loadStageScript(int stage) {
+    // Per-stage script if present, otherwise stage01.txt, otherwise built-in default
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "stage%02d.txt", stage);
+    bool loaded = false;
+    for (const char* name : {static_cast<const char*>(fileName), "stage01.txt"}) {
+        const AssetArchive::Entry* entry = m_assets.find(name);
+        if (entry) {
+            std::string text(reinterpret_cast<const char*>(m_assets.getData(*entry)), static_cast<size_t>(entry->size));
+            loaded = m_stageScript.loadFromString(text, entry->name);
+        } else {
+            loaded = m_stageScript.loadFromFile(getResourcePath(name));
+        }
+        if (loaded) {
+            break;
+        }
+    }
+    if (!loaded) {
+        SDL_Log("INFO: No stage script found, using built-in timeline");
+        m_stageScript.loadDefault();
+    }
+    m_stageScript.restart();
+    m_stageTime = 0.0f;
+    
+    // Pickups recycle pool slots; sized here so the stage itself never allocates for them
+    checkPoolAllocations();
+    m_powerUpPool.reserve(POWER_UP_POOL_SIZE);
+    m_itemBoxPool.reserve(ITEM_BOX_POOL_SIZE);
+    m_powerUps.reserve(POWER_UP_POOL_SIZE);
+    m_itemBoxes.reserve(ITEM_BOX_POOL_SIZE);
+    m_stagePoolBlocks = m_powerUpPool.getAllocationCount() + m_itemBoxPool.getAllocationCount();
+}
+
+void Game::checkPoolAllocations() {
+    // A stage should get by with the pool blocks reserved when it started; growth is
+    // legal (the pools grow with a warning) but counted so soak runs can report it
+    size_t blocks = m_powerUpPool.getAllocationCount() + m_itemBoxPool.getAllocationCount();
+    if (m_stagePoolBlocks != 0 && blocks != m_stagePoolBlocks) {
+        SDL_Log("WARNING: Pickup pools allocated %zu blocks during the stage", blocks - m_stagePoolBlocks);
+        m_poolGrowthBlocks += blocks - m_stagePoolBlocks;
+        m_stagePoolBlocks = blocks;
+    }
+}
+
+void Game::updateStageTimeline(float deltaTime) {
+    // Clock holds while the boss is alive
+    if (m_boss) {
+        return;
+    }
+    
+    bool waiting = false;
+    while (const StageEvent* event = m_stageScript.peekDue(m_stageTime)) {
+        if (event->type == StageEventType::WAIT_KILLS &&
+            m_enemyKillCount < static_cast<int>(event->value)) {
+            waiting = true;  // Hold clock until enough kills
+            break;
+        }
+        applyStageEvent(*event);
+        m_stageScript.advance();
+        
+        if (m_boss) {
+            return;  // Boss event: clock stops here
         }
     }
+    
+    if (!waiting) {
+        m_stageTime += deltaTime;
+    }
 }
 
-void Game::spawnBoss(int stage) {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-    
-    float bossX = windowWidth / 2.0f - 120.0f;  // Center horizontally (boss is 240 wide)
-    float bossY = -250.0f;  // Start above screen
-    
-    m_boss = std::make_unique<Boss>(bossX, bossY, stage);
-    
-    // Stop normal background music and play boss music
-    Mix_HaltMusic();
-    
-    Mix_Music* bossMusic = nullptr;
-    switch (stage) {
-        case 1:
-            bossMusic = m_boss01Music;
+void Game::applyStageEvent(const StageEvent& event) {
+    switch (event.type) {
+        case StageEventType::BACKGROUND:
+            m_nextSequenceSprite = getBackgroundSprite(event.id);
+            SDL_Log("INFO: Next background: %02d (t=%.1f)", event.id, m_stageTime);
             break;
-        case 2:
-            bossMusic = m_boss02Music;
+        case StageEventType::WAVE:
+            spawnWave(event);
             break;
-        case 3:
-            bossMusic = m_boss03Music;
+        case StageEventType::RANDOM_SPAWN:
+            m_enemySpawnInterval = event.value;
+            m_enemySpawnTimer = 0.0f;
             break;
-        case 4:
-            bossMusic = m_boss04Music;
+        case StageEventType::ITEM_ZONE:
+            m_itemZoneActive = (event.id != 0);
+            m_itemBoxSpawnInterval = event.value > 0.0f ? event.value : 2.0f;
+            m_itemBoxSpawnTimer = 0.0f;
+            SDL_Log("INFO: %s item box zone", m_itemZoneActive ? "Entering" : "Exiting");
             break;
-        default:
-            // Cycle through boss music if stage > 4
-            int musicIndex = ((stage - 1) % 4) + 1;
-            switch (musicIndex) {
-                case 1: bossMusic = m_boss01Music; break;
-                case 2: bossMusic = m_boss02Music; break;
-                case 3: bossMusic = m_boss03Music; break;
-                case 4: bossMusic = m_boss04Music; break;
-            }
+        case StageEventType::WAIT_KILLS:
+            SDL_Log("INFO: Stage wait passed (%d kills)", m_enemyKillCount);
+            break;
+        case StageEventType::BOSS:
+            spawnBoss(m_currentStage);
+            m_enemyKillCount = 0;
+            m_enemies.clear();  // Clear all enemies when boss appears
             break;
     }
+}
+
+void Game::addEnemy(std::unique_ptr<Enemy> enemy) {
+    if (m_tuning.enemyCooldownScale != 1.0f) {
+        enemy->scaleShootCooldown(m_tuning.enemyCooldownScale);
+    }
     
-    if (bossMusic) {
-        Mix_VolumeMusic(128);
-        if (Mix_PlayMusic(bossMusic, -1) == -1) {
-            SDL_Log("ERROR: Failed to play boss music: %s", Mix_GetError());
-        } else {
-            SDL_Log("INFO: Boss Stage %d spawned! Playing boss%02d music.", stage, stage);
+    // Insert after the last enemy of the same type so batches stay contiguous
+    auto position = std::upper_bound(m_enemies.begin(), m_enemies.end(), enemy->getType(),
+        [](Enemy::EnemyType type, const std::unique_ptr<Enemy>& other) {
+            return type < other->getType();
+        });
+    m_enemies.insert(position, std::move(enemy));
+}
+
+void Game::updateEnemyRange(size_t begin, size_t end, float deltaTime, float playerX, WorkerCommands& commands) {
+    // Movement in type-homogeneous batches (m_enemies is kept grouped by type)
+    std::unique_ptr<Enemy>* batchBegin = m_enemies.data() + begin;
+    std::unique_ptr<Enemy>* rangeEnd = m_enemies.data() + end;
+    while (batchBegin != rangeEnd) {
+        Enemy::EnemyType batchType = (*batchBegin)->getType();
+        std::unique_ptr<Enemy>* batchEnd = batchBegin + 1;
+        while (batchEnd != rangeEnd && (*batchEnd)->getType() == batchType) {
+            ++batchEnd;
+        }
+        Enemy::updateBatch(batchBegin, batchEnd, deltaTime, playerX);
+        batchBegin = batchEnd;
+    }
+    
+    for (size_t i = begin; i < end; i++) {
+        Enemy& enemy = *m_enemies[i];
+        
+        // Enemy shoots occasionally
+        if (enemy.canShoot()) {
+            float enemyCenterX = enemy.getX() + enemy.getWidth() / 2;
+            float enemyBottomY = enemy.getY() + enemy.getHeight();
+            commands.shoot(static_cast<uint32_t>(i), enemyCenterX, enemyBottomY);
+            
+            // Burst types (TYPE_05): burst shooting (3 bullets)
+            if (enemy.getBurstCount() > 0) {
+                enemy.decreaseBurstCount();
+                
+                // Continue burst (short delay between bullets)
+                if (enemy.getBurstCount() > 0) {
+                    enemy.resetShootTimer();
+                }
+            } else {
+                // Normal shooting for other types
+                enemy.resetShootTimer();
+            }
         }
-    } else {
-        SDL_Log("WARNING: Boss Stage %d spawned! (No boss music available)", stage);
     }
 }
 
-void Game::render() {
-    // Clear screen (black)
-    SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
-    SDL_RenderClear(m_renderer);
+void Game::mergeWorkerCommands() {
+    std::pmr::vector<QueuedShot> shots(&m_tickArena);
+    for (WorkerCommands& commands : m_workerCommands) {
+        shots.insert(shots.end(), commands.enemyShots.begin(), commands.enemyShots.end());
+        commands.enemyShots.clear();
+    }
     
-    // Draw background using slot system (first)
-    SDL_Texture* bg1Texture = m_bgSlot1Texture ? m_bgSlot1Texture : m_backgroundTexture;
-    SDL_Texture* bg2Texture = m_bgSlot2Texture ? m_bgSlot2Texture : m_backgroundTexture;
+    // Entity order = the order a serial loop would have produced
+    std::sort(shots.begin(), shots.end(), [](const QueuedShot& a, const QueuedShot& b) {
+        return a.order < b.order;
+    });
     
-    if (bg1Texture && bg2Texture) {
-        int windowWidth, windowHeight;
-        SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-        SDL_Rect bg1 = {0, static_cast<int>(m_backgroundY1), windowWidth, windowHeight};
-        SDL_Rect bg2 = {0, static_cast<int>(m_backgroundY2), windowWidth, windowHeight};
-        SDL_RenderCopy(m_renderer, bg1Texture, nullptr, &bg1);
-        SDL_RenderCopy(m_renderer, bg2Texture, nullptr, &bg2);
+    for (const QueuedShot& shot : shots) {
+        m_enemyBullets.spawn(shot.x, shot.y, Bullet::Owner::ENEMY);
     }
+}
 
-    // Render based on game state
-    if (m_gameState == GameState::START_SCREEN) {
-        renderStartScreen();
+void Game::spawnWave(const StageEvent& event) {
+    static const Enemy::EnemyType types[] = {
+        Enemy::EnemyType::TYPE_01, Enemy::EnemyType::TYPE_02, Enemy::EnemyType::TYPE_03,
+        Enemy::EnemyType::TYPE_04, Enemy::EnemyType::TYPE_05
+    };
+    Enemy::EnemyType type = types[event.id];
+    bool isSpecial = (type == Enemy::EnemyType::TYPE_03);  // TYPE_03 always drops items
+    
+    for (int i = 0; i < event.count; i++) {
+        float x = event.value;
+        float y = -40.0f;
+        switch (event.formation) {
+            case Formation::SINGLE:
+                break;
+            case Formation::LINE:
+                x += i * event.spacing;
+                break;
+            case Formation::COLUMN:
+                y -= i * event.spacing;
+                break;
+            case Formation::V: {
+                // Leader at the tip, then alternate left/right going back
+                int rank = (i + 1) / 2;
+                float side = (i % 2 == 1) ? -1.0f : 1.0f;
+                x += side * rank * event.spacing;
+                y -= rank * event.spacing;
+                break;
+            }
+        }
+        addEnemy(std::make_unique<Enemy>(x, y, type, isSpecial));
     }
-    else if (m_gameState == GameState::MENU) {
-        renderMenu();
+}
+
+SpriteId Game::getBackgroundSprite(int id) const {
+    switch (id) {
+        case 1: return SpriteId::BACKGROUND_01;
+        case 2: return SpriteId::BACKGROUND_02;
+        case 3: return SpriteId::BACKGROUND_03;
+        case 4: return SpriteId::BACKGROUND_04;
+        default: return SpriteId::BACKGROUND;
     }
-    else if (m_gameState == GameState::COUNTDOWN) {
-        renderCountdown();
+}
+
+void Game::buildSpriteTable() {
+    // Backgrounds are owned by m_backgroundStreamer
+    
+    // Missing movement sprites fall back to the legacy ship
+    SDL_Texture* shipTextures[] = {m_shipStopTexture, m_shipForwardTexture, m_shipBackwardTexture, m_shipLeftTexture, m_shipRightTexture};
+    for (int i = 0; i < 5; i++) {
+        m_sprites[static_cast<int>(SpriteId::SHIP_STOP) + i] = shipTextures[i] ? shipTextures[i] : m_playerTexture;
+    }
+    
+    SDL_Texture* enemyTextures[] = {m_enemy01Texture, m_enemy02Texture, m_enemy03Texture, m_enemy04Texture, m_enemy05Texture};
+    for (int i = 0; i < 5; i++) {
+        m_sprites[static_cast<int>(SpriteId::ENEMY_01) + i] = enemyTextures[i];
     }
-    else if (m_gameState == GameState::PLAYING) {
-        // Render player (using movement state texture)
-        SDL_Texture* currentShipTexture = m_shipStopTexture;
+    m_sprites[static_cast<int>(SpriteId::BOSS_01)] = m_boss01Texture;
+    
+    SDL_Texture* boomTextures[] = {m_boom01Texture, m_boom02Texture, m_boom03Texture, m_boom04Texture, m_boom05Texture, m_boom06Texture};
+    for (int i = 0; i < PLAYER_EXPLOSION_FRAMES; i++) {
+        m_sprites[static_cast<int>(SpriteId::BOOM_01) + i] = boomTextures[i];
+    }
+    
+    m_sprites[static_cast<int>(SpriteId::ITEM_BOX)] = m_itemBoxTexture;
+    m_sprites[static_cast<int>(SpriteId::ITEM_S)] = m_itemSTexture;
+    m_sprites[static_cast<int>(SpriteId::ITEM_L)] = m_itemLTexture;
+    m_sprites[static_cast<int>(SpriteId::ITEM_M)] = m_itemMTexture;
+}
+
+void Game::buildSnapshot(RenderSnapshot& snapshot) {
+    snapshot.clearDraws();
+    snapshot.gameState = static_cast<int>(m_gameState);
+    snapshot.tick = m_simulationTick;
+    
+    snapshot.background1 = m_bgSlot1;
+    snapshot.background2 = m_bgSlot2;
+    snapshot.backgroundY1 = m_backgroundY1;
+    snapshot.backgroundY2 = m_backgroundY2;
+    snapshot.backgroundNext = m_nextSequenceSprite;
+    
+    // World (paused games keep showing it under the overlay)
+    if (m_gameState == GameState::PLAYING || m_gameState == GameState::PAUSED) {
+        // Player sprite follows the movement state
+        SpriteId shipSprite = SpriteId::SHIP_STOP;
         if (m_player->getMovementState() == Player::MovementState::FORWARD) {
-            currentShipTexture = m_shipForwardTexture;
+            shipSprite = SpriteId::SHIP_FORWARD;
         } else if (m_player->getMovementState() == Player::MovementState::BACKWARD) {
-            currentShipTexture = m_shipBackwardTexture;
+            shipSprite = SpriteId::SHIP_BACKWARD;
         } else if (m_player->getMovementState() == Player::MovementState::LEFT) {
-            currentShipTexture = m_shipLeftTexture;
+            shipSprite = SpriteId::SHIP_LEFT;
         } else if (m_player->getMovementState() == Player::MovementState::RIGHT) {
-            currentShipTexture = m_shipRightTexture;
+            shipSprite = SpriteId::SHIP_RIGHT;
         }
+        m_player->draw(snapshot.sprites, shipSprite);
         
-        if (currentShipTexture) {
-            m_player->render(m_renderer, currentShipTexture, nullptr);
-        } else if (m_playerTexture) {
-            m_player->render(m_renderer, m_playerTexture, nullptr);
-        } else {
-            m_player->render(m_renderer);
-        }
-
-        // Render enemies (using different textures based on type)
-        for (auto& enemy : m_enemies) {
-            SDL_Texture* enemyTexture = nullptr;
-            
-            // Select texture based on enemy type
-            switch (enemy->getType()) {
-                case Enemy::EnemyType::TYPE_01:
-                    enemyTexture = m_enemy01Texture;
-                    break;
-                case Enemy::EnemyType::TYPE_02:
-                    enemyTexture = m_enemy02Texture;
-                    break;
-                case Enemy::EnemyType::TYPE_03:
-                    enemyTexture = m_enemy03Texture;
-                    break;
-                case Enemy::EnemyType::TYPE_04:
-                    enemyTexture = m_enemy04Texture;
-                    break;
-                case Enemy::EnemyType::TYPE_05:
-                    enemyTexture = m_enemy05Texture;
-                    break;
-            }
-            
-            if (enemyTexture) {
-                enemy->render(m_renderer, enemyTexture, nullptr);
-            } else {
-                enemy->render(m_renderer);
-            }
+        // Enemies (sprite from the archetype's sprite slot)
+        for (const auto& enemy : m_enemies) {
+            int spriteIndex = static_cast<int>(getArchetype(enemy->getType()).sprite);
+            enemy->draw(snapshot.sprites, static_cast<SpriteId>(static_cast<int>(SpriteId::ENEMY_01) + spriteIndex));
         }
         
-        // Render boss
         if (m_boss && m_boss->getState() != Boss::BossState::DEAD) {
-            if (m_boss01Texture) {
-                m_boss->render(m_renderer, m_boss01Texture, nullptr);
-            } else {
-                m_boss->render(m_renderer);
-            }
-            
-            // Render boss health bar
-            int barWidth = 300;
-            int barHeight = 20;
-            int barX = (getWindowWidth() - barWidth) / 2;
-            int barY = 10;
-            
-            // Background (red)
-            SDL_SetRenderDrawColor(m_renderer, 100, 0, 0, 255);
-            SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
-            SDL_RenderFillRect(m_renderer, &bgRect);
-            
-            // Health (green)
-            float healthPercent = static_cast<float>(m_boss->getHealth()) / m_boss->getMaxHealth();
-            SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
-            SDL_Rect healthRect = {barX, barY, static_cast<int>(barWidth * healthPercent), barHeight};
-            SDL_RenderFillRect(m_renderer, &healthRect);
-            
-            // Border (white)
-            SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
-            SDL_RenderDrawRect(m_renderer, &bgRect);
-        }
-
-        // Render bullets
-        for (auto& bullet : m_bullets) {
-            bullet->render(m_renderer);
-        }
-        
-        // Render enemy bullets
-        for (auto& bullet : m_enemyBullets) {
-            bullet->render(m_renderer);
+            m_boss->draw(snapshot.sprites, SpriteId::BOSS_01);
         }
         
-        // Render power-ups
-        for (auto& powerUp : m_powerUps) {
-            powerUp->render(m_renderer, m_itemSTexture, m_itemLTexture, m_itemMTexture);
+        // Bullets, split into one batch per color
+        for (const auto& bullet : m_bullets) {
+            SDL_Rect rect = {
+                static_cast<int>(bullet->getX()),
+                static_cast<int>(bullet->getY()),
+                static_cast<int>(bullet->getWidth()),
+                static_cast<int>(bullet->getHeight())
+            };
+            if (bullet->getType() == Bullet::BulletType::MISSILE) {
+                snapshot.playerMissiles.rects.push_back(rect);
+            } else {
+                snapshot.playerLasers.rects.push_back(rect);
+            }
         }
+        m_enemyBullets.draw(snapshot.enemyBullets.rects);
         
-        // Render item boxes
-        for (auto& itemBox : m_itemBoxes) {
-            itemBox->render(m_renderer, m_itemBoxTexture, m_itemSTexture, m_itemLTexture, m_itemMTexture);
-        }
+        for (const auto& powerUp : m_powerUps) {
+            powerUp->draw(snapshot.pickups);
+        }
+        for (const auto& itemBox : m_itemBoxes) {
+            itemBox->draw(snapshot.pickups);
+        }
+    }
+    
+    snapshot.bossVisible = m_boss && m_boss->getState() != Boss::BossState::DEAD;
+    snapshot.bossHealth = m_boss ? m_boss->getHealth() : 0;
+    snapshot.bossMaxHealth = m_boss ? m_boss->getMaxHealth() : 1;
+    
+    // HUD
+    snapshot.score = m_score;
+    snapshot.highScore = m_highScore;
+    snapshot.lives = m_lives;
+    snapshot.speedCount = m_player->getSpeedCount();
+    snapshot.speedLevel = m_player->getSpeedLevel();
+    snapshot.laserCount = m_player->getLaserCount();
+    snapshot.laserLevel = m_player->getLaserLevel();
+    snapshot.missileCount = m_player->getMissileCount();
+    snapshot.missileLevel = m_player->getMissileLevel();
+    snapshot.energy = m_player->getEnergy();
+    snapshot.maxEnergy = m_player->getMaxEnergy();
+    
+    // Screen state
+    snapshot.stateTimer = m_stateTimer;
+    snapshot.blinkTimer = m_blinkTimer;
+    snapshot.fadeAlpha = m_fadeAlpha;
+    
+    snapshot.explosionFrame = SpriteId::NONE;
+    if (m_gameState == GameState::EXPLODING) {
+        int frame = static_cast<int>(m_explosionTimer / PLAYER_EXPLOSION_FRAME_TIME);
+        if (frame < PLAYER_EXPLOSION_FRAMES) {
+            snapshot.explosionFrame = static_cast<SpriteId>(static_cast<int>(SpriteId::BOOM_01) + frame);
+        }
+        int boomSize = 80;  // Match player size
+        snapshot.explosionRect = {
+            static_cast<int>(m_explosionX - boomSize / 2),
+            static_cast<int>(m_explosionY - boomSize / 2),
+            boomSize,
+            boomSize
+        };
+    }
+    
+    snapshot.highScoreCount = 0;
+    for (size_t i = 0; i < m_highScores.size() && i < 10; i++) {
+        snapshot.highScores[snapshot.highScoreCount++] = m_highScores[i];
+    }
+}
+
+void Game::render() {
+    ALLOCATION_SCOPE("render");
+    m_frameArena.reset();
+    
+    // Newest published tick (the previous one stays valid if nothing new arrived)
+    m_snapshots.acquire();
+    const RenderSnapshot& snapshot = m_snapshots.front();
+    GameState state = static_cast<GameState>(snapshot.gameState);
+    
+    // Clear screen (black)
+    SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+    SDL_RenderClear(m_renderer);
+    
+    // Draw background using slot system (first)
+    renderBackground(snapshot);
+
+    // Render based on game state
+    if (state == GameState::START_SCREEN) {
+        renderStartScreen(snapshot);
+    }
+    else if (state == GameState::MENU) {
+        renderMenu(snapshot);
+    }
+    else if (state == GameState::COUNTDOWN) {
+        renderCountdown(snapshot);
+    }
+    else if (state == GameState::PLAYING || state == GameState::PAUSED) {
+        renderWorld(snapshot);
         
         // Render UI
-        renderUI();
+        renderUI(snapshot);
         
         // Show pause overlay if paused
-        if (m_gameState == GameState::PAUSED) {
+        if (state == GameState::PAUSED) {
             // Semi-transparent overlay
             SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
             SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 128);
-            int windowWidth, windowHeight;
-            SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+            int windowWidth = m_windowWidth;
+            int windowHeight = m_windowHeight;
             SDL_Rect overlay = {0, 0, windowWidth, windowHeight};
             SDL_RenderFillRect(m_renderer, &overlay);
+            SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_NONE);
             
             // Render "PAUSED" text
             SDL_Color white = {255, 255, 255, 255};
@@ -1677,34 +2286,233 @@ void Game::render() {
             }
         }
     }
-    else if (m_gameState == GameState::GAME_OVER) {
-        renderGameOver();
+    else if (state == GameState::EXPLODING) {
+        renderExplosion(snapshot);
+    }
+    else if (state == GameState::GAME_OVER) {
+        renderGameOver(snapshot);
     }
 
     // Present to screen
     SDL_RenderPresent(m_renderer);
 }
 
-void Game::renderUI() {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+void Game::prepareBackgrounds() {
+    m_backgroundsPrepared = true;
+    m_stripUpper = SpriteId::NONE;
+    m_stripLower = SpriteId::NONE;
+    if (!m_backgroundStreamer.isPrescaled()) {
+        SDL_Log("INFO: Render targets unsupported, backgrounds are scaled every frame");
+        return;
+    }
+    
+    m_backgroundStrip = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, m_windowWidth, m_windowHeight * 2);
+    if (m_backgroundStrip) {
+        SDL_SetTextureBlendMode(m_backgroundStrip, SDL_BLENDMODE_NONE);
+    } else {
+        SDL_Log("WARNING: Failed to create background strip: %s", SDL_GetError());
+    }
+}
+
+void Game::releaseBackgrounds() {
+    if (m_backgroundStrip) {
+        SDL_DestroyTexture(m_backgroundStrip);
+        m_backgroundStrip = nullptr;
+    }
+    m_backgroundStreamer.releaseTextures();
+    m_backgroundsPrepared = false;
+}
+
+SpriteId Game::resolveBackground(SpriteId sprite) const {
+    // Missing images fall back to the legacy background
+    if (sprite == SpriteId::NONE || m_backgroundStreamer.isMissing(sprite)) {
+        return SpriteId::BACKGROUND;
+    }
+    return sprite;
+}
+
+void Game::renderBackground(const RenderSnapshot& snapshot) {
+    if (!m_backgroundsPrepared) {
+        prepareBackgrounds();
+    }
+    
+    // The two slots are always one screen apart; find which one is on top
+    bool slot1Upper = snapshot.backgroundY1 <= snapshot.backgroundY2;
+    SpriteId upper = resolveBackground(slot1Upper ? snapshot.background1 : snapshot.background2);
+    SpriteId lower = resolveBackground(slot1Upper ? snapshot.background2 : snapshot.background1);
+    float upperY = slot1Upper ? snapshot.backgroundY1 : snapshot.backgroundY2;
+    
+    // Keep what is on screen plus the segment the next wrap brings in; evict the rest
+    SpriteId resident[] = {upper, lower, resolveBackground(snapshot.backgroundNext)};
+    m_backgroundStreamer.retain(resident, 3);
+    
+    // A segment still decoding borrows the other slot's image for a frame or two
+    if (!m_backgroundStreamer.getTexture(upper)) upper = lower;
+    if (!m_backgroundStreamer.getTexture(lower)) lower = upper;
+    SDL_Texture* upperTexture = m_backgroundStreamer.getTexture(upper);
+    SDL_Texture* lowerTexture = m_backgroundStreamer.getTexture(lower);
+    if (!upperTexture || !lowerTexture) {
+        return;
+    }
+    
+    if (m_backgroundStrip) {
+        // Recompose only when a slot wraps and picks up a new background
+        if (upper != m_stripUpper || lower != m_stripLower) {
+            SDL_Texture* previousTarget = SDL_GetRenderTarget(m_renderer);
+            SDL_SetRenderTarget(m_renderer, m_backgroundStrip);
+            SDL_Rect upperRect = {0, 0, m_windowWidth, m_windowHeight};
+            SDL_Rect lowerRect = {0, m_windowHeight, m_windowWidth, m_windowHeight};
+            SDL_RenderCopy(m_renderer, upperTexture, nullptr, &upperRect);
+            SDL_RenderCopy(m_renderer, lowerTexture, nullptr, &lowerRect);
+            SDL_SetRenderTarget(m_renderer, previousTarget);
+            m_stripUpper = upper;
+            m_stripLower = lower;
+        }
+        
+        int offset = std::max(0, std::min(m_windowHeight, -static_cast<int>(upperY)));
+        SDL_Rect source = {0, offset, m_windowWidth, m_windowHeight};
+        SDL_RenderCopy(m_renderer, m_backgroundStrip, &source, nullptr);
+        return;
+    }
+    
+    // No strip: scale both slots every frame
+    SDL_Rect upperRect = {0, static_cast<int>(upperY), m_windowWidth, m_windowHeight};
+    SDL_Rect lowerRect = {0, static_cast<int>(upperY) + m_windowHeight, m_windowWidth, m_windowHeight};
+    SDL_RenderCopy(m_renderer, upperTexture, nullptr, &upperRect);
+    SDL_RenderCopy(m_renderer, lowerTexture, nullptr, &lowerRect);
+}
+
+void Game::drawSprites(const std::vector<SpriteDraw>& sprites) {
+    for (const SpriteDraw& sprite : sprites) {
+        SDL_Texture* texture = m_sprites[static_cast<int>(sprite.sprite)];
+        if (texture) {
+            if (sprite.alpha != 255) {
+                SDL_SetTextureAlphaMod(texture, sprite.alpha);
+                SDL_RenderCopy(m_renderer, texture, nullptr, &sprite.rect);
+                SDL_SetTextureAlphaMod(texture, 255);
+            } else {
+                SDL_RenderCopy(m_renderer, texture, nullptr, &sprite.rect);
+            }
+        } else {
+            // Fallback: colored rectangle
+            SDL_SetRenderDrawColor(m_renderer, sprite.fallback.r, sprite.fallback.g, sprite.fallback.b, sprite.fallback.a);
+            SDL_RenderFillRect(m_renderer, &sprite.rect);
+            if (sprite.outline) {
+                SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+                SDL_RenderDrawRect(m_renderer, &sprite.rect);
+            }
+        }
+    }
+}
+
+void Game::drawRectBatch(const RectBatch& batch) {
+    if (batch.rects.empty()) {
+        return;
+    }
+    SDL_SetRenderDrawColor(m_renderer, batch.color.r, batch.color.g, batch.color.b, batch.color.a);
+    SDL_RenderFillRects(m_renderer, batch.rects.data(), static_cast<int>(batch.rects.size()));
+}
+
+void Game::renderWorld(const RenderSnapshot& snapshot) {
+    // Player, enemies, boss
+    drawSprites(snapshot.sprites);
+    
+    // Render boss health bar
+    if (snapshot.bossVisible) {
+        int barWidth = 300;
+        int barHeight = 20;
+        int barX = (m_windowWidth - barWidth) / 2;
+        int barY = 10;
+        
+        // Background (red)
+        SDL_SetRenderDrawColor(m_renderer, 100, 0, 0, 255);
+        SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
+        SDL_RenderFillRect(m_renderer, &bgRect);
+        
+        // Health (green)
+        float healthPercent = static_cast<float>(snapshot.bossHealth) / snapshot.bossMaxHealth;
+        SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
+        SDL_Rect healthRect = {barX, barY, static_cast<int>(barWidth * healthPercent), barHeight};
+        SDL_RenderFillRect(m_renderer, &healthRect);
+        
+        // Border (white)
+        SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
+        SDL_RenderDrawRect(m_renderer, &bgRect);
+    }
+
+    // Bullets (one batched draw per color)
+    drawRectBatch(snapshot.playerLasers);
+    drawRectBatch(snapshot.playerMissiles);
+    drawRectBatch(snapshot.enemyBullets);
+    
+    // Power-ups and item boxes
+    drawSprites(snapshot.pickups);
+}
+
+void Game::renderExplosion(const RenderSnapshot& snapshot) {
+    // Explosion frame over the background; black screen after the last frame
+    if (snapshot.explosionFrame == SpriteId::NONE) {
+        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
+        SDL_RenderClear(m_renderer);
+        return;
+    }
+    
+    SDL_Texture* boomTexture = m_sprites[static_cast<int>(snapshot.explosionFrame)];
+    if (boomTexture) {
+        SDL_RenderCopy(m_renderer, boomTexture, nullptr, &snapshot.explosionRect);
+    }
+}
+
+void Game::renderUI(const RenderSnapshot& snapshot) {
+    ALLOCATION_SCOPE("ui");
+    HudValues hud = {
+        snapshot.score, snapshot.highScore, snapshot.lives,
+        snapshot.speedCount, snapshot.speedLevel,
+        snapshot.laserCount, snapshot.laserLevel,
+        snapshot.missileCount, snapshot.missileLevel,
+        snapshot.energy, snapshot.maxEnergy
+    };
+    
+    if (!m_hudTexture) {
+        drawHud(hud);
+        return;
+    }
+    
+    // Rebuild the layer only when something on it changed
+    if (m_hudDirty || hud != m_hudValues) {
+        SDL_SetRenderTarget(m_renderer, m_hudTexture);
+        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(m_renderer);
+        drawHud(hud);
+        SDL_SetRenderTarget(m_renderer, nullptr);
+        
+        m_hudValues = hud;
+        m_hudDirty = false;
+    }
+    SDL_RenderCopy(m_renderer, m_hudTexture, nullptr, nullptr);
+}
+
+void Game::drawHud(const HudValues& hud) {
+    int windowWidth = m_windowWidth;
+    int windowHeight = m_windowHeight;
     
     // Top left: Display score with 7-segment style
     SDL_Color scoreColor = {255, 255, 255, 255};  // White
-    draw7SegmentNumber(m_score, 10, 10, 20, 30, 5, scoreColor);
+    draw7SegmentNumber(hud.score, 10, 10, 20, 30, 5, scoreColor);
     
     // Top center: Display high score with 7-segment style (gold)
     SDL_Color highScoreColor = {255, 215, 0, 255}; // Gold
-    int highScoreWidth = static_cast<int>(std::to_string(m_highScore).length()) * 25;
-    draw7SegmentNumber(m_highScore, (windowWidth - highScoreWidth) / 2, 10, 20, 30, 5, highScoreColor);
+    int digits[MAX_NUMBER_DIGITS];
+    int highScoreWidth = formatDigits(hud.highScore, digits) * 25;
+    draw7SegmentNumber(hud.highScore, (windowWidth - highScoreWidth) / 2, 10, 20, 30, 5, highScoreColor);
     
     // Top right: Display remaining lives with ship_stop icons
     if (m_shipStopTexture) {
         int shipIconSize = 24;  // Small ship icon size
         int spacing = 5;  // Spacing between icons
-        int startX = windowWidth - (m_lives * (shipIconSize + spacing));
+        int startX = windowWidth - (hud.lives * (shipIconSize + spacing));
         
-        for (int i = 0; i < m_lives; i++) {
+        for (int i = 0; i < hud.lives; i++) {
             SDL_Rect shipRect = {
                 startX + i * (shipIconSize + spacing),
                 10,
@@ -1727,7 +2535,7 @@ void Game::renderUI() {
             SDL_Rect iconRect = {10, startY, iconSize, iconSize};
             SDL_RenderCopy(m_renderer, m_itemSTexture, nullptr, &iconRect);
         }
-        std::string speedText = std::to_string(m_player->getSpeedCount()) + "/3 Lv." + std::to_string(m_player->getSpeedLevel());
+        std::pmr::string speedText = formatText(&m_frameArena, "%d/3 Lv.%d", hud.speedCount, hud.speedLevel);
         SDL_Color speedColor = {0, 255, 255, 255};
         SDL_Surface* speedSurface = TTF_RenderText_Blended(m_subtitleFont, speedText.c_str(), speedColor);
         if (speedSurface) {
@@ -1745,7 +2553,7 @@ void Game::renderUI() {
             SDL_Rect iconRect = {10, startY + lineHeight, iconSize, iconSize};
             SDL_RenderCopy(m_renderer, m_itemLTexture, nullptr, &iconRect);
         }
-        std::string laserText = std::to_string(m_player->getLaserCount()) + "/3 Lv." + std::to_string(m_player->getLaserLevel());
+        std::pmr::string laserText = formatText(&m_frameArena, "%d/3 Lv.%d", hud.laserCount, hud.laserLevel);
         SDL_Color laserColor = {255, 255, 0, 255};
         SDL_Surface* laserSurface = TTF_RenderText_Blended(m_subtitleFont, laserText.c_str(), laserColor);
         if (laserSurface) {
@@ -1763,7 +2571,7 @@ void Game::renderUI() {
             SDL_Rect iconRect = {10, startY + lineHeight * 2, iconSize, iconSize};
             SDL_RenderCopy(m_renderer, m_itemMTexture, nullptr, &iconRect);
         }
-        std::string missileText = std::to_string(m_player->getMissileCount()) + "/3 Lv." + std::to_string(m_player->getMissileLevel());
+        std::pmr::string missileText = formatText(&m_frameArena, "%d/3 Lv.%d", hud.missileCount, hud.missileLevel);
         SDL_Color missileColor = {255, 165, 0, 255};
         SDL_Surface* missileSurface = TTF_RenderText_Blended(m_subtitleFont, missileText.c_str(), missileColor);
         if (missileSurface) {
@@ -1788,12 +2596,12 @@ void Game::renderUI() {
     SDL_RenderDrawRect(m_renderer, &energyBg);
     
     // Energy bar fill
-    int energyWidth = static_cast<int>(196.0f * m_player->getEnergy() / m_player->getMaxEnergy());
+    int energyWidth = static_cast<int>(196.0f * hud.energy / hud.maxEnergy);
     if (energyWidth > 0) {
         // Color based on energy level
-        if (m_player->getEnergy() > m_player->getMaxEnergy() * 0.6f) {
+        if (hud.energy > hud.maxEnergy * 0.6f) {
             SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255); // Green
-        } else if (m_player->getEnergy() > m_player->getMaxEnergy() * 0.3f) {
+        } else if (hud.energy > hud.maxEnergy * 0.3f) {
             SDL_SetRenderDrawColor(m_renderer, 255, 255, 0, 255); // Yellow
         } else {
             SDL_SetRenderDrawColor(m_renderer, 255, 0, 0, 255); // Red
@@ -1804,7 +2612,7 @@ void Game::renderUI() {
     
     // Energy text
     if (m_subtitleFont) {
-        std::string energyText = "E:" + std::to_string(m_player->getEnergy()) + "/" + std::to_string(m_player->getMaxEnergy());
+        std::pmr::string energyText = formatText(&m_frameArena, "E:%d/%d", hud.energy, hud.maxEnergy);
         SDL_Color energyColor = {255, 255, 255, 255};
         SDL_Surface* energySurface = TTF_RenderText_Blended(m_subtitleFont, energyText.c_str(), energyColor);
         if (energySurface) {
@@ -1820,7 +2628,16 @@ void Game::renderUI() {
 }
 
 void Game::clean() {
-    // Release sounds
+    // Simulation must not touch anything released below
+    stopSimulationThread();
+    
+    // Headless games never initialized SDL (other instances may still be running)
+    if (m_headless) {
+        return;
+    }
+    
+    // Release sounds (no voice may still be playing a chunk)
+    m_soundVoices.stopAll();
     if (m_shootSound) {
         Mix_FreeChunk(m_shootSound);
         m_shootSound = nullptr;
@@ -1829,59 +2646,15 @@ void Game::clean() {
         Mix_FreeChunk(m_explosionSound);
         m_explosionSound = nullptr;
     }
-    if (m_bgMusic) {
-        Mix_HaltMusic();
-        Mix_FreeMusic(m_bgMusic);
-        m_bgMusic = nullptr;
-    }
-    if (m_stage01Music) {
-        Mix_FreeMusic(m_stage01Music);
-        m_stage01Music = nullptr;
-    }
-    if (m_stage02Music) {
-        Mix_FreeMusic(m_stage02Music);
-        m_stage02Music = nullptr;
-    }
-    if (m_boss01Music) {
-        Mix_FreeMusic(m_boss01Music);
-        m_boss01Music = nullptr;
-    }
-    if (m_boss02Music) {
-        Mix_FreeMusic(m_boss02Music);
-        m_boss02Music = nullptr;
-    }
-    if (m_boss03Music) {
-        Mix_FreeMusic(m_boss03Music);
-        m_boss03Music = nullptr;
-    }
-    if (m_boss04Music) {
-        Mix_FreeMusic(m_boss04Music);
-        m_boss04Music = nullptr;
+    if (m_bossHitSound) {
+        Mix_FreeChunk(m_bossHitSound);
+        m_bossHitSound = nullptr;
     }
+    m_music.stop();
     
     Mix_CloseAudio();
     
     // Release textures
-    if (m_backgroundTexture) {
-        SDL_DestroyTexture(m_backgroundTexture);
-        m_backgroundTexture = nullptr;
-    }
-    if (m_background01Texture) {
-        SDL_DestroyTexture(m_background01Texture);
-        m_background01Texture = nullptr;
-    }
-    if (m_background02Texture) {
-        SDL_DestroyTexture(m_background02Texture);
-        m_background02Texture = nullptr;
-    }
-    if (m_background03Texture) {
-        SDL_DestroyTexture(m_background03Texture);
-        m_background03Texture = nullptr;
-    }
-    if (m_background04Texture) {
-        SDL_DestroyTexture(m_background04Texture);
-        m_background04Texture = nullptr;
-    }
     if (m_playerTexture) {
         SDL_DestroyTexture(m_playerTexture);
         m_playerTexture = nullptr;
@@ -1965,6 +2738,13 @@ void Game::clean() {
         SDL_DestroyTexture(m_startLogoTexture);
         m_startLogoTexture = nullptr;
     }
+    if (m_hudTexture) {
+        SDL_DestroyTexture(m_hudTexture);
+        m_hudTexture = nullptr;
+    }
+    releaseDigitStrips();
+    releaseBackgrounds();
+    m_backgroundStreamer.stop();
     
     // Release fonts
     if (m_titleFont) {
@@ -1982,6 +2762,9 @@ void Game::clean() {
     
     TTF_Quit();
     
+    // Nothing loaded from the mapping is alive any more
+    m_assets.close();
+    
     if (m_renderer) {
         SDL_DestroyRenderer(m_renderer);
         m_renderer = nullptr;
@@ -1995,9 +2778,9 @@ void Game::clean() {
     SDL_Quit();
 }
 
-void Game::renderStartScreen() {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+void Game::renderStartScreen(const RenderSnapshot& snapshot) {
+    int windowWidth = m_windowWidth;
+    int windowHeight = m_windowHeight;
     
     // Black background
     SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 255);
@@ -2016,7 +2799,7 @@ void Game::renderStartScreen() {
     // "Press Button to start" 깜빡이는 텍스트
     if (m_subtitleFont) {
         // 0.5초마다 깜빡임
-        bool visible = (static_cast<int>(m_blinkTimer * 2) % 2) == 0;
+        bool visible = (static_cast<int>(snapshot.blinkTimer * 2) % 2) == 0;
         
         if (visible) {
             SDL_Color textColor = {255, 255, 255, 255};  // 흰색
@@ -2039,14 +2822,14 @@ void Game::renderStartScreen() {
     }
 }
 
-void Game::renderMenu() {
+void Game::renderMenu(const RenderSnapshot& snapshot) {
     // Apply alpha value for fade-in effect
     // Display "ASO PLUS" title
     if (m_titleTexture) {
-        int textW, textH, windowWidth;
+        int textW, textH;
         SDL_QueryTexture(m_titleTexture, nullptr, nullptr, &textW, &textH);
-        SDL_GetWindowSize(m_window, &windowWidth, nullptr);
-        SDL_SetTextureAlphaMod(m_titleTexture, m_fadeAlpha);
+        int windowWidth = m_windowWidth;
+        SDL_SetTextureAlphaMod(m_titleTexture, snapshot.fadeAlpha);
         SDL_Rect titleRect = {
             (windowWidth - textW) / 2,
             100,
@@ -2056,8 +2839,7 @@ void Game::renderMenu() {
         SDL_RenderCopy(m_renderer, m_titleTexture, nullptr, &titleRect);
     } else {
         // 폰트가 없을 경우 폴백: 간단한 박스
-        int windowWidth;
-        SDL_GetWindowSize(m_window, &windowWidth, nullptr);
+        int windowWidth = m_windowWidth;
         SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
         SDL_Rect titleRect = { windowWidth / 2 - 150, 150, 300, 50 };
         SDL_RenderDrawRect(m_renderer, &titleRect);
@@ -2075,9 +2857,8 @@ void Game::renderMenu() {
         if (subtitleSurface) {
             SDL_Texture* subtitleTexture = SDL_CreateTextureFromSurface(m_renderer, subtitleSurface);
             if (subtitleTexture) {
-                SDL_SetTextureAlphaMod(subtitleTexture, m_fadeAlpha);
-                int windowWidth;
-                SDL_GetWindowSize(m_window, &windowWidth, nullptr);
+                SDL_SetTextureAlphaMod(subtitleTexture, snapshot.fadeAlpha);
+                int windowWidth = m_windowWidth;
                 SDL_Rect subtitleRect = {
                     (windowWidth - subtitleSurface->w) / 2,
                     300,
@@ -2091,28 +2872,27 @@ void Game::renderMenu() {
         }
     } else {
         // Fallback when font is not available
-        int windowWidth;
-        SDL_GetWindowSize(m_window, &windowWidth, nullptr);
+        int windowWidth = m_windowWidth;
         SDL_SetRenderDrawColor(m_renderer, 0, 255, 0, 255);
         SDL_Rect startRect = { windowWidth / 2 - 100, 300, 200, 30 };
         SDL_RenderFillRect(m_renderer, &startRect);
     }
 }
 
-void Game::renderCountdown() {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+void Game::renderCountdown(const RenderSnapshot& snapshot) {
+    int windowWidth = m_windowWidth;
+    int windowHeight = m_windowHeight;
     
     // Determine which text to show based on timer
     const char* displayText = nullptr;
-    if (m_stateTimer > 1.0f) {
+    if (snapshot.stateTimer > 1.0f) {
         displayText = "GET READY";  // Show for first second
     } else {
         displayText = "GO";  // Show for last second
     }
     
     // Blinking effect: show/hide every 0.5 seconds
-    float blinkPhase = fmod(m_stateTimer, 1.0f);  // Get fractional part of timer
+    float blinkPhase = fmod(snapshot.stateTimer, 1.0f);  // Get fractional part of timer
     bool shouldShow = (static_cast<int>(blinkPhase * 2) % 2) == 0;
     
     if (shouldShow && m_titleFont) {
@@ -2135,6 +2915,20 @@ void Game::renderCountdown() {
     }
 }
 
+// Lit segments for each digit (A, B, C, D, E, F, G)
+static const bool SEVEN_SEGMENT_TABLE[10][7] = {
+    {1,1,1,1,1,1,0}, // 0
+    {0,1,1,0,0,0,0}, // 1
+    {1,1,0,1,1,0,1}, // 2
+    {1,1,1,1,0,0,1}, // 3
+    {0,1,1,0,0,1,1}, // 4
+    {1,0,1,1,0,1,1}, // 5
+    {1,0,1,1,1,1,1}, // 6
+    {1,1,1,0,0,0,0}, // 7
+    {1,1,1,1,1,1,1}, // 8
+    {1,1,1,1,0,1,1}  // 9
+};
+
 // Draw a single 7-segment digit
 void Game::draw7SegmentDigit(int digit, int x, int y, int width, int height, SDL_Color color) {
     // 7-segment layout:
@@ -2148,19 +2942,7 @@ void Game::draw7SegmentDigit(int digit, int x, int y, int width, int height, SDL
     int segWidth = width - segThickness * 2;
     int segHeight = (height - segThickness * 3) / 2;
     
-    // Define which segments are lit for each digit (A, B, C, D, E, F, G)
-    bool segments[10][7] = {
-        {1,1,1,1,1,1,0}, // 0
-        {0,1,1,0,0,0,0}, // 1
-        {1,1,0,1,1,0,1}, // 2
-        {1,1,1,1,0,0,1}, // 3
-        {0,1,1,0,0,1,1}, // 4
-        {1,0,1,1,0,1,1}, // 5
-        {1,0,1,1,1,1,1}, // 6
-        {1,1,1,0,0,0,0}, // 7
-        {1,1,1,1,1,1,1}, // 8
-        {1,1,1,1,0,1,1}  // 9
-    };
+    const bool (&segments)[10][7] = SEVEN_SEGMENT_TABLE;
     
     if (digit < 0 || digit > 9) return;
     
@@ -2209,21 +2991,128 @@ void Game::draw7SegmentDigit(int digit, int x, int y, int width, int height, SDL
     }
 }
 
+// Decimal digits of number, most significant first, without going through std::string.
+// A minus sign becomes a blank slot (-1). Returns the slot count.
+int Game::formatDigits(int number, int* digits) {
+    unsigned int magnitude = number < 0 ? 0u - static_cast<unsigned int>(number) : static_cast<unsigned int>(number);
+    int reversed[10];
+    int count = 0;
+    do {
+        reversed[count++] = static_cast<int>(magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    
+    int length = 0;
+    if (number < 0) {
+        digits[length++] = -1;
+    }
+    while (count > 0) {
+        digits[length++] = reversed[--count];
+    }
+    return length;
+}
+
+SDL_Texture* Game::getDigitStrip(int digitWidth, int digitHeight) {
+    for (const DigitStrip& strip : m_digitStrips) {
+        if (strip.digitWidth == digitWidth && strip.digitHeight == digitHeight) {
+            return strip.texture;
+        }
+    }
+    
+    // First use of this size: draw 0-9 side by side into a transparent target
+    SDL_Texture* texture = nullptr;
+    if (SDL_RenderTargetSupported(m_renderer)) {
+        texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, digitWidth * 10, digitHeight);
+    }
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        
+        // May be called while drawing into the HUD layer
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(m_renderer);
+        SDL_SetRenderTarget(m_renderer, texture);
+        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(m_renderer);
+        SDL_Color white = {255, 255, 255, 255};
+        for (int digit = 0; digit < 10; digit++) {
+            draw7SegmentDigit(digit, digit * digitWidth, 0, digitWidth, digitHeight, white);
+        }
+        SDL_SetRenderTarget(m_renderer, previousTarget);
+    } else {
+        SDL_Log("INFO: No digit strip for %dx%d, drawing segments directly", digitWidth, digitHeight);
+    }
+    
+    m_digitStrips.push_back({digitWidth, digitHeight, texture});
+    return texture;
+}
+
+void Game::releaseDigitStrips() {
+    for (const DigitStrip& strip : m_digitStrips) {
+        if (strip.texture) {
+            SDL_DestroyTexture(strip.texture);
+        }
+    }
+    m_digitStrips.clear();
+}
+
 // Draw a multi-digit number using 7-segment display
 void Game::draw7SegmentNumber(int number, int x, int y, int digitWidth, int digitHeight, int spacing, SDL_Color color) {
-    std::string numStr = std::to_string(number);
-    int currentX = x;
+    int digits[MAX_NUMBER_DIGITS];
+    int count = formatDigits(number, digits);
+    
+    SDL_Texture* strip = getDigitStrip(digitWidth, digitHeight);
+    if (!strip) {
+        for (int i = 0; i < count; i++) {
+            draw7SegmentDigit(digits[i], x + i * (digitWidth + spacing), y, digitWidth, digitHeight, color);
+        }
+        return;
+    }
     
-    for (char c : numStr) {
-        int digit = c - '0';
-        draw7SegmentDigit(digit, currentX, y, digitWidth, digitHeight, color);
-        currentX += digitWidth + spacing;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // One textured draw for the whole number; vertex color tints the white strip
+    SDL_Vertex vertices[MAX_NUMBER_DIGITS * 4];
+    int indices[MAX_NUMBER_DIGITS * 6];
+    int quads = 0;
+    for (int i = 0; i < count; i++) {
+        if (digits[i] < 0) {
+            continue;
+        }
+        float left = static_cast<float>(x + i * (digitWidth + spacing));
+        float top = static_cast<float>(y);
+        float right = left + digitWidth;
+        float bottom = top + digitHeight;
+        float u0 = digits[i] / 10.0f;
+        float u1 = (digits[i] + 1) / 10.0f;
+        
+        SDL_Vertex* quad = vertices + quads * 4;
+        quad[0] = {{left, top}, color, {u0, 0.0f}};
+        quad[1] = {{right, top}, color, {u1, 0.0f}};
+        quad[2] = {{right, bottom}, color, {u1, 1.0f}};
+        quad[3] = {{left, bottom}, color, {u0, 1.0f}};
+        
+        int* index = indices + quads * 6;
+        int base = quads * 4;
+        index[0] = base; index[1] = base + 1; index[2] = base + 2;
+        index[3] = base; index[4] = base + 2; index[5] = base + 3;
+        quads++;
+    }
+    SDL_RenderGeometry(m_renderer, strip, vertices, quads * 4, indices, quads * 6);
+#else
+    SDL_SetTextureColorMod(strip, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(strip, color.a);
+    for (int i = 0; i < count; i++) {
+        if (digits[i] < 0) {
+            continue;
+        }
+        SDL_Rect srcRect = {digits[i] * digitWidth, 0, digitWidth, digitHeight};
+        SDL_Rect dstRect = {x + i * (digitWidth + spacing), y, digitWidth, digitHeight};
+        SDL_RenderCopy(m_renderer, strip, &srcRect, &dstRect);
     }
+#endif
 }
 
-void Game::renderGameOver() {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+void Game::renderGameOver(const RenderSnapshot& snapshot) {
+    int windowWidth = m_windowWidth;
+    int windowHeight = m_windowHeight;
     
     // "GAME OVER" text
     if (m_uiFont) {
@@ -2247,16 +3136,17 @@ void Game::renderGameOver() {
     
     // Current score with 7-segment display
     SDL_Color scoreColor = {255, 255, 255, 255};
-    int scoreWidth = static_cast<int>(std::to_string(m_score).length()) * 35;
-    draw7SegmentNumber(m_score, (windowWidth - scoreWidth) / 2, 180, 30, 45, 5, scoreColor);
+    int digits[MAX_NUMBER_DIGITS];
+    int scoreWidth = formatDigits(snapshot.score, digits) * 35;
+    draw7SegmentNumber(snapshot.score, (windowWidth - scoreWidth) / 2, 180, 30, 45, 5, scoreColor);
     
     // High scores list
     if (m_subtitleFont) {
         int y = 280;
-        for (size_t i = 0; i < m_highScores.size() && i < 10; i++) {
+        for (size_t i = 0; i < static_cast<size_t>(snapshot.highScoreCount) && i < 10; i++) {
             // Rank number
             SDL_Color rankColor = {255, 215, 0, 255};
-            std::string rankText = std::to_string(i + 1) + ".";
+            std::pmr::string rankText = formatText(&m_frameArena, "%d.", static_cast<int>(i + 1));
             SDL_Surface* rankSurface = TTF_RenderText_Blended(m_subtitleFont, rankText.c_str(), rankColor);
             if (rankSurface) {
                 SDL_Texture* rankTexture = SDL_CreateTextureFromSurface(m_renderer, rankSurface);
@@ -2270,7 +3160,7 @@ void Game::renderGameOver() {
             
             // Score with 7-segment
             SDL_Color hsColor = {200, 200, 200, 255};
-            draw7SegmentNumber(m_highScores[i], windowWidth / 2 - 50, y - 3, 15, 22, 3, hsColor);
+            draw7SegmentNumber(snapshot.highScores[i], windowWidth / 2 - 50, y - 3, 15, 22, 3, hsColor);
             
             y += 30;
         }
@@ -2301,7 +3191,7 @@ void Game::drawNumber(int number, int x, int y, int scale) {
     // 7-세그먼트 스타일로 숫자 그리기
     if (number == 0) number = 0; // 음수 방지
     
-    std::string numStr = std::to_string(number);
+    std::pmr::string numStr = formatText(&m_frameArena, "%d", number);
     int digitWidth = 8 * scale;
     int spacing = 2 * scale;
     
@@ -2372,67 +3262,90 @@ void Game::addHighScore(int score) {
         m_highScore = m_highScores[0];
     }
     
-    saveHighScores();
+    // Headless sessions (bots, batch runs) keep their scores to themselves
+    if (!m_headless) {
+        saveHighScores();
+    }
 }
 
 void Game::dropPowerUp(float x, float y) {
-    // Random power-up type with weighted probabilities
-    int rand_val = rand() % 100;
-    PowerUpType powerUpType;
+    // Random category from the tuning weights (defaults: 20% speed/laser/missile,
+    // 10% energy/bonus, 5% 1UP/voltage/keep/penalty)
+    int total = 0;
+    for (int weight : m_tuning.dropWeights) {
+        total += weight;
+    }
+    if (total <= 0) {
+        return;
+    }
+    int rand_val = m_random.nextInt(total);
+    int category = 0;
+    while (rand_val >= m_tuning.dropWeights[category]) {
+        rand_val -= m_tuning.dropWeights[category];
+        category++;
+    }
     
-    if (rand_val < 20) {
-        // 20% - Speed
-        powerUpType = PowerUpType::SPEED;
-    } else if (rand_val < 40) {
-        // 20% - Laser
-        powerUpType = PowerUpType::LASER;
-    } else if (rand_val < 60) {
-        // 20% - Missile
-        powerUpType = PowerUpType::MISSILE;
-    } else if (rand_val < 70) {
-        // 10% - Energy (random size)
-        int energy_type = rand() % 3;
-        if (energy_type == 0) {
-            powerUpType = PowerUpType::ENERGY_SMALL;
-        } else if (energy_type == 1) {
-            powerUpType = PowerUpType::ENERGY_MEDIUM;
-        } else {
-            powerUpType = PowerUpType::ENERGY_LARGE;
-        }
-    } else if (rand_val < 80) {
-        // 10% - Bonus
-        powerUpType = PowerUpType::BONUS;
-    } else if (rand_val < 85) {
-        // 5% - 1UP
-        powerUpType = PowerUpType::ONE_UP;
-    } else if (rand_val < 90) {
-        // 5% - Voltage
-        powerUpType = PowerUpType::VOLTAGE;
-    } else if (rand_val < 95) {
-        // 5% - Keep items (random)
-        int keep_type = rand() % 3;
-        if (keep_type == 0) {
-            powerUpType = PowerUpType::KEEP_SPEED;
-        } else if (keep_type == 1) {
-            powerUpType = PowerUpType::KEEP_LASER;
-        } else {
-            powerUpType = PowerUpType::KEEP_MISSILE;
+    PowerUpType powerUpType;
+    switch (static_cast<DropCategory>(category)) {
+        case DropCategory::SPEED:
+            powerUpType = PowerUpType::SPEED;
+            break;
+        case DropCategory::LASER:
+            powerUpType = PowerUpType::LASER;
+            break;
+        case DropCategory::MISSILE:
+            powerUpType = PowerUpType::MISSILE;
+            break;
+        case DropCategory::ENERGY: {
+            // Random size
+            int energy_type = m_random.nextInt(3);
+            if (energy_type == 0) {
+                powerUpType = PowerUpType::ENERGY_SMALL;
+            } else if (energy_type == 1) {
+                powerUpType = PowerUpType::ENERGY_MEDIUM;
+            } else {
+                powerUpType = PowerUpType::ENERGY_LARGE;
+            }
+            break;
         }
-    } else {
-        // 5% - Penalty items (careful!)
-        int penalty_type = rand() % 4;
-        if (penalty_type == 0) {
-            powerUpType = PowerUpType::SPEED_DOWN;
-        } else if (penalty_type == 1) {
-            powerUpType = PowerUpType::LASER_DOWN;
-        } else if (penalty_type == 2) {
-            powerUpType = PowerUpType::MISSILE_DOWN;
-        } else {
-            powerUpType = PowerUpType::ENERGY_DOWN;
+        case DropCategory::BONUS:
+            powerUpType = PowerUpType::BONUS;
+            break;
+        case DropCategory::ONE_UP:
+            powerUpType = PowerUpType::ONE_UP;
+            break;
+        case DropCategory::VOLTAGE:
+            powerUpType = PowerUpType::VOLTAGE;
+            break;
+        case DropCategory::KEEP: {
+            // Keep items (random)
+            int keep_type = m_random.nextInt(3);
+            if (keep_type == 0) {
+                powerUpType = PowerUpType::KEEP_SPEED;
+            } else if (keep_type == 1) {
+                powerUpType = PowerUpType::KEEP_LASER;
+            } else {
+                powerUpType = PowerUpType::KEEP_MISSILE;
+            }
+            break;
+        }
+        default: {
+            // Penalty items (careful!)
+            int penalty_type = m_random.nextInt(4);
+            if (penalty_type == 0) {
+                powerUpType = PowerUpType::SPEED_DOWN;
+            } else if (penalty_type == 1) {
+                powerUpType = PowerUpType::LASER_DOWN;
+            } else if (penalty_type == 2) {
+                powerUpType = PowerUpType::MISSILE_DOWN;
+            } else {
+                powerUpType = PowerUpType::ENERGY_DOWN;
+            }
+            break;
         }
     }
     
-    m_powerUps.push_back(std::make_unique<PowerUp>(x - 15, y, powerUpType));
+    m_powerUps.push_back(m_powerUpPool.acquire(x - 15, y, powerUpType));
 }
 
 void Game::checkPowerUpCollection() {
@@ -2517,10 +3430,9 @@ void Game::checkPowerUpCollection() {
             }
             
             // Play sound (reuse shoot sound for now)
-            if (m_shootSound) {
-                Mix_PlayChannel(-1, m_shootSound, 0);
-            }
+            m_soundVoices.trigger(SoundId::PICKUP, (*powerUpIt)->getX() + (*powerUpIt)->getWidth() / 2, (*powerUpIt)->getY() + (*powerUpIt)->getHeight() / 2);
             
+            m_sessionStats.pickups++;
             powerUpIt = m_powerUps.erase(powerUpIt);
         } else {
             ++powerUpIt;
@@ -2559,10 +3471,9 @@ void Game::checkItemBoxCollection() {
             }
             
             // Play sound
-            if (m_shootSound) {
-                Mix_PlayChannel(-1, m_shootSound, 0);
-            }
+            m_soundVoices.trigger(SoundId::PICKUP, (*boxIt)->getX() + (*boxIt)->getWidth() / 2, (*boxIt)->getY() + (*boxIt)->getHeight() / 2);
             
+            m_sessionStats.pickups++;
             boxIt = m_itemBoxes.erase(boxIt);
         } else {
             ++boxIt;
@@ -2586,13 +3497,11 @@ void Game::checkMissileItemBoxCollision() {
                         (*bulletIt)->getY() + (*bulletIt)->getHeight() > box->getY()) {
                         
                         // Reveal the box (open it)
-                        box->reveal();
+                        box->reveal(m_random);
                         SDL_Log("INFO: Item box opened!");
                         
                         // Play explosion sound
-                        if (m_explosionSound) {
-                            Mix_PlayChannel(-1, m_explosionSound, 0);
-                        }
+                        m_soundVoices.trigger(SoundId::ITEM_BOX_OPEN, box->getX() + box->getWidth() / 2, box->getY() + box->getHeight() / 2);
                         
                         bulletIt = m_bullets.erase(bulletIt);
                         bulletRemoved = true;
@@ -2608,18 +3517,60 @@ void Game::checkMissileItemBoxCollision() {
     }
 }
 
+bool Game::buildMissileTargets() {
+    bool homing = std::any_of(m_bullets.begin(), m_bullets.end(), [](const std::unique_ptr<Bullet>& bullet) {
+        return bullet->isHoming();
+    });
+    if (!homing) {
+        return false;
+    }
+    
+    // Hidden boxes (what missiles open), plus the weak point while the boss can take hits
+    size_t boxCount = m_itemBoxes.size();
+    bool bossTarget = m_boss && m_boss->getState() == Boss::BossState::FIGHTING;
+    m_targetGrid.build(boxCount + 1, [&](size_t i, Aabb& box) {
+        if (i == boxCount) {
+            if (!bossTarget) {
+                return false;
+            }
+            box = {m_boss->getWeakPointX(), m_boss->getWeakPointY(), m_boss->getWeakPointWidth(), m_boss->getWeakPointHeight()};
+            return true;
+        }
+        const ItemBox& itemBox = *m_itemBoxes[i];
+        box = {itemBox.getX(), itemBox.getY(), itemBox.getWidth(), itemBox.getHeight()};
+        return itemBox.getState() == ItemBox::BoxState::HIDDEN;
+    });
+    return true;
+}
+
+void Game::aimMissile(Bullet& missile) const {
+    // Nearest target still ahead: missiles do not turn back for one they have passed
+    float x = missile.getX() + missile.getWidth() / 2;
+    float y = missile.getY() + missile.getHeight() / 2;
+    uint32_t targets[MISSILE_TARGET_CANDIDATES];
+    float distances[MISSILE_TARGET_CANDIDATES];
+    int found = m_targetGrid.findNearest(x, y, MISSILE_TARGET_CANDIDATES, targets, distances);
+    for (int i = 0; i < found; i++) {
+        const Aabb& box = m_targetGrid.getBox(targets[i]);
+        if (box.y + box.h / 2 < y) {
+            missile.setTarget(box.x + box.w / 2, box.y + box.h / 2);
+            return;
+        }
+    }
+    missile.clearTarget();
+}
+
 void Game::spawnItemBoxes() {
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
+    int windowWidth = m_windowWidth;
     
     // Spawn 3-5 random item boxes at the start
-    int boxCount = 3 + (rand() % 3);  // 3-5 boxes
+    int boxCount = 3 + m_random.nextInt(3);  // 3-5 boxes
     
     for (int i = 0; i < boxCount; i++) {
-        float boxX = 50.0f + (rand() % (windowWidth - 100));
+        float boxX = 50.0f + m_random.nextInt(windowWidth - 100);
         float boxY = -200.0f - (i * 150.0f);  // Stagger vertically
         
-        m_itemBoxes.push_back(std::make_unique<ItemBox>(boxX, boxY));
+        m_itemBoxes.push_back(m_itemBoxPool.acquire(boxX, boxY));
     }
     
     SDL_Log("INFO: Spawned %d item boxes", boxCount);
@@ -1,5 +1,4 @@
 #include "ItemBox.h"
-#include <cstdlib>
 
 ItemBox::ItemBox(float x, float y)
     : m_x(x)
@@ -11,13 +10,10 @@ ItemBox::ItemBox(float x, float y)
 {
 }
 
-ItemBox::~ItemBox() {
-}
-
-void ItemBox::reveal() {
+void ItemBox::reveal(Random& random) {
     if (m_state == BoxState::HIDDEN) {
         // Randomly choose S, L, or M when revealed
-        int randomChoice = rand() % 3;
+        int randomChoice = random.nextInt(3);
         switch (randomChoice) {
             case 0:
                 m_state = BoxState::REVEALED_S;
@@ -39,7 +35,7 @@ void ItemBox::update(float deltaTime) {
     m_y += 50.0f * deltaTime;  // Same as background scroll speed
 }
 
-void ItemBox::render(SDL_Renderer* renderer, SDL_Texture* boxTexture, SDL_Texture* sTexture, SDL_Texture* lTexture, SDL_Texture* mTexture) {
+void ItemBox::draw(std::vector<SpriteDraw>& out) const {
     SDL_Rect dstRect = {
         static_cast<int>(m_x),
         static_cast<int>(m_y),
@@ -47,39 +43,15 @@ void ItemBox::render(SDL_Renderer* renderer, SDL_Texture* boxTexture, SDL_Textur
         static_cast<int>(m_height)
     };
 
-    SDL_Texture* currentTexture = nullptr;
-    
+    // Sprite for the current state, colored rectangle if its texture is missing
     if (m_state == BoxState::HIDDEN) {
-        currentTexture = boxTexture;  // Show box when hidden
+        out.push_back({dstRect, SpriteId::ITEM_BOX, 255, {100, 100, 100, 255}, false});  // Gray box
     } else if (m_state == BoxState::REVEALED_S) {
-        currentTexture = sTexture;  // Show S when revealed
+        out.push_back({dstRect, SpriteId::ITEM_S, 255, {0, 255, 0, 255}, false});  // Green for speed
     } else if (m_state == BoxState::REVEALED_L) {
-        currentTexture = lTexture;  // Show L when revealed
+        out.push_back({dstRect, SpriteId::ITEM_L, 255, {255, 255, 0, 255}, false});  // Yellow for laser
     } else if (m_state == BoxState::REVEALED_M) {
-        currentTexture = mTexture;  // Show M when revealed
-    }
-
-    if (currentTexture) {
-        SDL_RenderCopy(renderer, currentTexture, nullptr, &dstRect);
-    } else {
-        // Fallback: draw colored rectangle
-        if (m_state == BoxState::HIDDEN) {
-            SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);  // Gray box
-        } else if (m_state == BoxState::REVEALED_S) {
-            SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);  // Green for speed
-        } else if (m_state == BoxState::REVEALED_L) {
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);  // Yellow for laser
-        } else if (m_state == BoxState::REVEALED_M) {
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);  // Red for missile
-        }
-        SDL_RenderFillRect(renderer, &dstRect);
-        
-        // Debug: log when falling back to colored rectangle
-        static int logCount = 0;
-        if (logCount < 5) {
-            SDL_Log("WARNING: ItemBox using fallback rendering (texture is null)");
-            logCount++;
-        }
+        out.push_back({dstRect, SpriteId::ITEM_M, 255, {255, 0, 0, 255}, false});  // Red for missile
     }
 }
 
@@ -0,0 +1,139 @@
+#include "JobSystem.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned workerCount)
+    : m_threadCount(workerCount + 1)
+    , m_queues(new WorkQueue[workerCount + 1])
+    , m_queuedJobs(0)
+    , m_stopping(false)
+{
+    m_workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1);
+    }
+    SDL_Log("INFO: Job system started with %u worker threads", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+unsigned JobSystem::defaultWorkerCount() {
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 2 ? hardwareThreads - 2 : 0;
+}
+
+unsigned JobSystem::workerCountFor(unsigned threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return threadCount - 1;  // The caller is thread 0
+}
+
+void JobSystem::run(Task& task, size_t count, size_t grain) {
+    // A few chunks per thread is enough for stealing to even out the load
+    unsigned threadCount = getThreadCount();
+    size_t maxJobs = static_cast<size_t>(threadCount) * 4;
+    grain = std::max(grain, (count + maxJobs - 1) / maxJobs);
+    size_t jobCount = (count + grain - 1) / grain;
+    
+    task.remaining = jobCount;
+    m_queuedJobs += jobCount;
+    
+    // Deal chunks round-robin over every thread's queue
+    for (size_t i = 0; i < jobCount; i++) {
+        Job job = {&task, i * grain, std::min(count, (i + 1) * grain)};
+        unsigned thread = static_cast<unsigned>(i % threadCount);
+        if (!push(thread, job)) {
+            m_queuedJobs--;
+            execute(job, 0);  // Queue full: run it here
+        }
+    }
+    
+    // Taking the lock orders the count update before any worker's wait check
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wake.notify_all();
+    
+    // Work (and steal) until every chunk of this task is done
+    while (task.remaining.load() > 0) {
+        Job job;
+        if (popOrSteal(0, job)) {
+            execute(job, 0);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::push(unsigned thread, const Job& job) {
+    WorkQueue& queue = m_queues[thread];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.size == QUEUE_CAPACITY) {
+        return false;
+    }
+    queue.jobs[(queue.head + queue.size) % QUEUE_CAPACITY] = job;
+    queue.size++;
+    return true;
+}
+
+bool JobSystem::popOrSteal(unsigned thread, Job& job) {
+    unsigned threadCount = getThreadCount();
+    
+    // Own queue first (newest job, still warm in cache)
+    {
+        WorkQueue& queue = m_queues[thread];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.size > 0) {
+            queue.size--;
+            job = queue.jobs[(queue.head + queue.size) % QUEUE_CAPACITY];
+            m_queuedJobs--;
+            return true;
+        }
+    }
+    
+    // Steal the oldest job from another thread
+    for (unsigned i = 1; i < threadCount; i++) {
+        WorkQueue& victim = m_queues[(thread + i) % threadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.size > 0) {
+            job = victim.jobs[victim.head];
+            victim.head = (victim.head + 1) % QUEUE_CAPACITY;
+            victim.size--;
+            m_queuedJobs--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::execute(const Job& job, unsigned thread) {
+    Task* task = job.task;
+    task->invoke(task->context, job.begin, job.end, thread);
+    task->remaining.fetch_sub(1);
+}
+
+void JobSystem::workerLoop(unsigned thread) {
+    while (true) {
+        Job job;
+        if (popOrSteal(thread, job)) {
+            execute(job, thread);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wake.wait(lock, [this]() { return m_stopping.load() || m_queuedJobs.load() > 0; });
+        if (m_stopping) {
+            return;
+        }
+    }
+}
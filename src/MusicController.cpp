@@ -0,0 +1,284 @@
+#include "MusicController.h"
+#include <algorithm>
+
+MusicController::MusicController()
+    : m_started(false)
+    , m_frequency(0)
+    , m_channels(0)
+    , m_target(MusicTrack::NONE)
+    , m_targetVolume(MIX_MAX_VOLUME)
+    , m_targetFade(0.0f)
+    , m_targetDelay(0.0f)
+    , m_targetPending(false)
+    , m_prepared(MusicTrack::NONE)
+    , m_playing(MusicTrack::NONE)
+    , m_commandHead(0)
+    , m_commandTail(0)
+    , m_incoming(0)
+    , m_fadeFrames(0)
+    , m_fadeFrame(0)
+    , m_stopping(false)
+{
+    for (Track& track : m_tracks) {
+        track.fallback = MusicTrack::NONE;
+        track.state = TrackState::MISSING;  // Until setTrack() gives it a file
+        track.chunk = nullptr;
+    }
+    for (int i = 0; i < 2; i++) {
+        m_decks[i] = {nullptr, 0, 0.0f};
+        m_deckChunks[i].store(nullptr);
+    }
+}
+
+MusicController::~MusicController() {
+    stop();
+}
+
+void MusicController::setTrack(MusicTrack track, const std::string& path, MusicTrack fallback) {
+    Track& slot = m_tracks[static_cast<int>(track)];
+    slot.path = path;
+    slot.fallback = fallback;
+    slot.state = TrackState::UNLOADED;
+}
+
+bool MusicController::start(Loader loader) {
+    Uint16 format = 0;
+    if (!Mix_QuerySpec(&m_frequency, &format, &m_channels)) {
+        return false;
+    }
+    if (format != AUDIO_S16SYS) {
+        SDL_Log("WARNING: Music disabled, mixer format 0x%04x is not 16-bit", format);
+        return false;
+    }
+
+    m_loader = std::move(loader);
+    m_stopping = false;
+    m_loaderThread = std::thread(&MusicController::loaderLoop, this);
+    if (!Mix_RegisterEffect(MIX_CHANNEL_POST, &MusicController::postEffect, nullptr, this)) {
+        SDL_Log("WARNING: Failed to register music effect: %s", Mix_GetError());
+    }
+    m_started = true;
+    return true;
+}
+
+void MusicController::stop() {
+    if (!m_started) {
+        return;
+    }
+    m_started = false;
+
+    // Waits for a running callback, after which no chunk is read any more
+    Mix_UnregisterEffect(MIX_CHANNEL_POST, &MusicController::postEffect);
+
+    {
+        std::lock_guard<std::mutex> lock(m_loadMutex);
+        m_stopping = true;
+    }
+    m_loadWake.notify_all();
+    m_loaderThread.join();
+
+    for (auto& loaded : m_loaded) {
+        if (loaded.second) {
+            Mix_FreeChunk(loaded.second);
+        }
+    }
+    m_loaded.clear();
+    m_loadRequests.clear();
+    for (Track& track : m_tracks) {
+        if (track.chunk) {
+            Mix_FreeChunk(track.chunk);
+            track.chunk = nullptr;
+            track.state = TrackState::UNLOADED;
+        }
+    }
+}
+
+void MusicController::prepare(MusicTrack track) {
+    m_prepared = track;
+    update(0.0f);
+}
+
+void MusicController::play(MusicTrack track, int volume, float fadeSeconds, float delaySeconds) {
+    m_target = track;
+    m_targetVolume = volume;
+    m_targetFade = fadeSeconds;
+    m_targetDelay = delaySeconds;
+    m_targetPending = true;
+    update(0.0f);
+}
+
+MusicTrack MusicController::resolve(MusicTrack track) const {
+    // Follow fallbacks past tracks that failed to load
+    for (int i = 0; i < static_cast<int>(MusicTrack::COUNT) && track != MusicTrack::NONE; i++) {
+        const Track& slot = m_tracks[static_cast<int>(track)];
+        if (slot.state != TrackState::MISSING) {
+            return track;
+        }
+        track = slot.fallback;
+    }
+    return MusicTrack::NONE;
+}
+
+void MusicController::update(float deltaTime) {
+    if (!m_started) {
+        return;
+    }
+
+    // Collect finished loads
+    std::vector<std::pair<MusicTrack, Mix_Chunk*>> loaded;
+    {
+        std::lock_guard<std::mutex> lock(m_loadMutex);
+        loaded.swap(m_loaded);
+    }
+    for (auto& result : loaded) {
+        Track& slot = m_tracks[static_cast<int>(result.first)];
+        slot.chunk = result.second;
+        slot.state = result.second ? TrackState::READY : TrackState::MISSING;
+        if (!result.second) {
+            SDL_Log("INFO: Music unavailable: %s", slot.path.c_str());
+        }
+    }
+
+    // Start loading whatever is wanted next (a missing track's fallback included)
+    bool requested = false;
+    MusicTrack wanted[] = {resolve(m_prepared), m_targetPending ? resolve(m_target) : MusicTrack::NONE};
+    for (MusicTrack track : wanted) {
+        Track& slot = m_tracks[static_cast<int>(track)];
+        if (track != MusicTrack::NONE && slot.state == TrackState::UNLOADED) {
+            slot.state = TrackState::LOADING;
+            std::lock_guard<std::mutex> lock(m_loadMutex);
+            m_loadRequests.push_back(track);
+            requested = true;
+        }
+    }
+    if (requested) {
+        m_loadWake.notify_one();
+    }
+
+    // Hand the crossfade to the callback once it is due and the track is in memory
+    if (m_targetPending) {
+        m_targetDelay -= deltaTime;
+        MusicTrack track = resolve(m_target);
+        const Track& slot = m_tracks[static_cast<int>(track)];
+        bool ready = track == MusicTrack::NONE || slot.state == TrackState::READY;
+        if (m_targetDelay <= 0.0f && ready) {
+            if (track == m_playing) {
+                m_targetPending = false;  // Already playing: keep going, no restart
+            } else {
+                uint32_t head = m_commandHead.load(std::memory_order_relaxed);
+                if (head - m_commandTail.load(std::memory_order_acquire) < COMMAND_CAPACITY) {
+                    Command& command = m_commands[head % COMMAND_CAPACITY];
+                    command.chunk = track == MusicTrack::NONE ? nullptr : slot.chunk;
+                    command.volume = static_cast<float>(m_targetVolume) / MIX_MAX_VOLUME;
+                    command.fadeFrames = static_cast<uint32_t>(std::max(0.0f, m_targetFade) * m_frequency);
+                    m_commandHead.store(head + 1, std::memory_order_release);
+                    m_playing = track;
+                    m_targetPending = false;
+                }
+            }
+        }
+    }
+
+    releaseUnused();
+}
+
+void MusicController::releaseUnused() {
+    // Only safe once the callback has taken every command we sent
+    if (m_commandTail.load(std::memory_order_acquire) != m_commandHead.load(std::memory_order_relaxed)) {
+        return;
+    }
+    const Mix_Chunk* deck0 = m_deckChunks[0].load(std::memory_order_acquire);
+    const Mix_Chunk* deck1 = m_deckChunks[1].load(std::memory_order_acquire);
+    MusicTrack keep[] = {m_playing, resolve(m_prepared), m_targetPending ? resolve(m_target) : MusicTrack::NONE};
+
+    for (int i = 0; i < static_cast<int>(MusicTrack::COUNT); i++) {
+        Track& slot = m_tracks[i];
+        if (slot.state != TrackState::READY || slot.chunk == deck0 || slot.chunk == deck1) {
+            continue;
+        }
+        if (std::find(std::begin(keep), std::end(keep), static_cast<MusicTrack>(i)) != std::end(keep)) {
+            continue;
+        }
+        Mix_FreeChunk(slot.chunk);
+        slot.chunk = nullptr;
+        slot.state = TrackState::UNLOADED;
+    }
+}
+
+void MusicController::postEffect(int channel, void* stream, int length, void* userData) {
+    (void)channel;
+    static_cast<MusicController*>(userData)->mix(static_cast<int16_t*>(stream), length / static_cast<int>(sizeof(int16_t)));
+}
+
+void MusicController::mix(int16_t* samples, int count) {
+    // New crossfades: the playing deck becomes the outgoing one (anything still fading out is cut)
+    uint32_t tail = m_commandTail.load(std::memory_order_relaxed);
+    uint32_t head = m_commandHead.load(std::memory_order_acquire);
+    for (; tail != head; tail++) {
+        const Command& command = m_commands[tail % COMMAND_CAPACITY];
+        m_incoming = 1 - m_incoming;
+        m_decks[m_incoming] = {command.chunk, 0, command.volume};
+        m_fadeFrames = command.fadeFrames;
+        m_fadeFrame = 0;
+    }
+
+    Deck& in = m_decks[m_incoming];
+    Deck& out = m_decks[1 - m_incoming];
+    const int16_t* inPcm = in.chunk ? reinterpret_cast<const int16_t*>(in.chunk->abuf) : nullptr;
+    const int16_t* outPcm = out.chunk ? reinterpret_cast<const int16_t*>(out.chunk->abuf) : nullptr;
+    uint32_t inLength = in.chunk ? in.chunk->alen / sizeof(int16_t) / m_channels * m_channels : 0;
+    uint32_t outLength = out.chunk ? out.chunk->alen / sizeof(int16_t) / m_channels * m_channels : 0;
+
+    if (inLength > 0 || outLength > 0) {
+        for (int i = 0; i + m_channels <= count; i += m_channels) {
+            float fade = m_fadeFrame < m_fadeFrames ? static_cast<float>(m_fadeFrame) / m_fadeFrames : 1.0f;
+            float inGain = fade * in.volume;
+            float outGain = (1.0f - fade) * out.volume;
+            for (int c = 0; c < m_channels; c++) {
+                float value = samples[i + c];
+                if (inLength > 0) {
+                    value += inPcm[in.position++] * inGain;
+                }
+                if (outLength > 0) {
+                    value += outPcm[out.position++] * outGain;
+                }
+                samples[i + c] = static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, value)));
+            }
+            // Tracks loop
+            if (in.position >= inLength) in.position = 0;
+            if (out.position >= outLength) out.position = 0;
+            if (m_fadeFrame < m_fadeFrames) m_fadeFrame++;
+        }
+    }
+    if (m_fadeFrame >= m_fadeFrames) {
+        out.chunk = nullptr;  // Faded out: the game thread may free it
+    }
+
+    m_deckChunks[0].store(m_decks[0].chunk, std::memory_order_release);
+    m_deckChunks[1].store(m_decks[1].chunk, std::memory_order_release);
+    m_commandTail.store(tail, std::memory_order_release);
+}
+
+void MusicController::loaderLoop() {
+    std::unique_lock<std::mutex> lock(m_loadMutex);
+    while (true) {
+        m_loadWake.wait(lock, [this] { return m_stopping || !m_loadRequests.empty(); });
+        if (m_stopping) {
+            return;
+        }
+
+        MusicTrack track = m_loadRequests.front();
+        m_loadRequests.erase(m_loadRequests.begin());
+        std::string path = m_tracks[static_cast<int>(track)].path;
+
+        // Decode (or read from the PCM cache) off the game thread
+        lock.unlock();
+        Mix_Chunk* chunk = m_loader(path);
+        if (chunk) {
+            SDL_Log("INFO: Music loaded: %s", path.c_str());
+        }
+        lock.lock();
+
+        m_loaded.push_back({track, chunk});
+    }
+}
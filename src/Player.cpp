@@ -28,9 +28,6 @@ Player::Player(float x, float y)
 {
 }
 
-Player::~Player() {
-}
-
 void Player::setMousePosition(float mouseX, float mouseY) {
     m_mouseX = mouseX;
     m_mouseY = mouseY;
@@ -107,32 +104,15 @@ void Player::clampToScreen(int screenWidth, int screenHeight) {
     if (m_y > screenHeight - m_height) m_y = screenHeight - m_height;
 }
 
-void Player::render(SDL_Renderer* renderer) {
-    // 플레이어를 파란색 사각형으로 그리기
-    SDL_SetRenderDrawColor(renderer, 0, 150, 255, 255);
+void Player::draw(std::vector<SpriteDraw>& out, SpriteId sprite) const {
     SDL_Rect rect = {
         static_cast<int>(m_x),
         static_cast<int>(m_y),
         static_cast<int>(m_width),
         static_cast<int>(m_height)
     };
-    SDL_RenderFillRect(renderer, &rect);
-}
-
-void Player::render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect) {
-    if (texture) {
-        SDL_Rect dstRect = {
-            static_cast<int>(m_x),
-            static_cast<int>(m_y),
-            static_cast<int>(m_width),
-            static_cast<int>(m_height)
-        };
-        // srcRect가 nullptr이면 전체 텍스처 사용
-        SDL_RenderCopy(renderer, texture, srcRect, &dstRect);
-    } else {
-        // 폴백: 기본 렌더링
-        render(renderer);
-    }
+    // Fallback: blue rectangle
+    out.push_back({rect, sprite, 255, {0, 150, 255, 255}, false});
 }
 
 bool Player::canShoot() const {
@@ -244,6 +224,18 @@ bool Player::takeDamage(int amount) {
     return (m_energy <= 0);
 }
 
+void Player::respawn(float x, float y) {
+    m_x = x;
+    m_y = y;
+    m_mouseX = x;
+    m_mouseY = y;
+    m_lastX = x;
+    m_lastY = y;
+    m_shootTimer = 0.0f;
+    m_movementState = MovementState::STOP;
+    resetOnDeath();
+}
+
 // Reset on death
 void Player::resetOnDeath() {
     // Reset power levels unless kept
@@ -12,15 +12,12 @@ PowerUp::PowerUp(float x, float y, PowerUpType type)
 {
 }
 
-PowerUp::~PowerUp() {
-}
-
 void PowerUp::update(float deltaTime) {
     m_y += m_speed * deltaTime;
     m_blinkTimer += deltaTime;
 }
 
-void PowerUp::render(SDL_Renderer* renderer, SDL_Texture* sTexture, SDL_Texture* lTexture, SDL_Texture* mTexture) {
+void PowerUp::draw(std::vector<SpriteDraw>& out) const {
     // Blinking effect for some items
     bool shouldBlink = (m_type == PowerUpType::SPEED_DOWN || 
                         m_type == PowerUpType::LASER_DOWN || 
@@ -31,28 +28,6 @@ void PowerUp::render(SDL_Renderer* renderer, SDL_Texture* sTexture, SDL_Texture*
         return; // Skip rendering (blink off)
     }
     
-    // Use textures for S, L, M power-ups
-    SDL_Texture* texture = nullptr;
-    if (m_type == PowerUpType::SPEED && sTexture) {
-        texture = sTexture;
-    } else if (m_type == PowerUpType::LASER && lTexture) {
-        texture = lTexture;
-    } else if (m_type == PowerUpType::MISSILE && mTexture) {
-        texture = mTexture;
-    }
-    
-    if (texture) {
-        SDL_Rect rect = {
-            static_cast<int>(m_x),
-            static_cast<int>(m_y),
-            static_cast<int>(m_width),
-            static_cast<int>(m_height)
-        };
-        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-        return;
-    }
-    
-    // Fallback to colored rectangles for other power-up types
     SDL_Rect rect = {
         static_cast<int>(m_x),
         static_cast<int>(m_y),
@@ -60,62 +35,69 @@ void PowerUp::render(SDL_Renderer* renderer, SDL_Texture* sTexture, SDL_Texture*
         static_cast<int>(m_height)
     };
     
+    // Textures for S, L, M power-ups; the others are outlined colored rectangles
+    SpriteId sprite = SpriteId::NONE;
+    if (m_type == PowerUpType::SPEED) {
+        sprite = SpriteId::ITEM_S;
+    } else if (m_type == PowerUpType::LASER) {
+        sprite = SpriteId::ITEM_L;
+    } else if (m_type == PowerUpType::MISSILE) {
+        sprite = SpriteId::ITEM_M;
+    }
+    
     // Set color based on type (fallback for other types)
+    SDL_Color fallback = {255, 255, 255, 255};
     switch (m_type) {
         case PowerUpType::SPEED:
-            SDL_SetRenderDrawColor(renderer, 0, 255, 255, 255); // Cyan
+            fallback = {0, 255, 255, 255}; // Cyan
             break;
         case PowerUpType::LASER:
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow
+            fallback = {255, 255, 0, 255}; // Yellow
             break;
         case PowerUpType::MISSILE:
-            SDL_SetRenderDrawColor(renderer, 255, 165, 0, 255); // Orange
+            fallback = {255, 165, 0, 255}; // Orange
             break;
         case PowerUpType::ENERGY_SMALL:
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White
+            fallback = {255, 255, 255, 255}; // White
             break;
         case PowerUpType::ENERGY_MEDIUM:
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow
+            fallback = {255, 255, 0, 255}; // Yellow
             break;
         case PowerUpType::ENERGY_LARGE:
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); // Red
+            fallback = {255, 0, 0, 255}; // Red
             break;
         case PowerUpType::BONUS:
-            SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255); // Gold
+            fallback = {255, 215, 0, 255}; // Gold
             break;
         case PowerUpType::KEEP_SPEED:
-            SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255); // Red K
+            fallback = {255, 100, 100, 255}; // Red K
             break;
         case PowerUpType::KEEP_LASER:
-            SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255); // Yellow K
+            fallback = {255, 255, 100, 255}; // Yellow K
             break;
         case PowerUpType::KEEP_MISSILE:
-            SDL_SetRenderDrawColor(renderer, 100, 150, 255, 255); // Blue K
+            fallback = {100, 150, 255, 255}; // Blue K
             break;
         case PowerUpType::ONE_UP:
-            SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); // Green
+            fallback = {0, 255, 0, 255}; // Green
             break;
         case PowerUpType::VOLTAGE:
-            SDL_SetRenderDrawColor(renderer, 200, 50, 255, 255); // Purple
+            fallback = {200, 50, 255, 255}; // Purple
             break;
         case PowerUpType::SPEED_DOWN:
         case PowerUpType::LASER_DOWN:
         case PowerUpType::MISSILE_DOWN:
         case PowerUpType::ENERGY_DOWN:
-            SDL_SetRenderDrawColor(renderer, 139, 69, 19, 255); // Brown (penalty)
+            fallback = {139, 69, 19, 255}; // Brown (penalty)
             break;
         case PowerUpType::ARMOR_HEAD:
         case PowerUpType::ARMOR_LEFT:
         case PowerUpType::ARMOR_RIGHT:
-            SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255); // Gray
+            fallback = {150, 150, 150, 255}; // Gray
             break;
     }
     
-    SDL_RenderFillRect(renderer, &rect);
-    
-    // Draw border
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderDrawRect(renderer, &rect);
+    out.push_back({rect, sprite, 255, fallback, true});
 }
 
 std::string PowerUp::getLabel() const {
@@ -0,0 +1,109 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : m_cellSize(cellSize)
+    , m_invCellSize(1.0f / cellSize)
+    , m_minX(0.0f)
+    , m_minY(0.0f)
+    , m_columns(1)
+    , m_rows(1)
+    , m_itemCount(0)
+{
+}
+
+void SpatialGrid::setBounds(float minX, float minY, float maxX, float maxY) {
+    m_minX = minX;
+    m_minY = minY;
+    m_columns = static_cast<int>((maxX - minX) * m_invCellSize) + 1;
+    m_rows = static_cast<int>((maxY - minY) * m_invCellSize) + 1;
+    m_cellStart.reserve(getCellCount() + 1);
+    m_cellFill.reserve(getCellCount());
+}
+
+void SpatialGrid::reserve(size_t items) {
+    m_boxes.reserve(items);
+    m_items.reserve(items * 4);  // Most boxes are smaller than a cell: at most 4 cells each
+}
+
+int SpatialGrid::clampColumn(float x) const {
+    float column = (x - m_minX) * m_invCellSize;
+    if (column < 0.0f) return 0;
+    if (column >= static_cast<float>(m_columns - 1)) return m_columns - 1;
+    return static_cast<int>(column);
+}
+
+int SpatialGrid::clampRow(float y) const {
+    float row = (y - m_minY) * m_invCellSize;
+    if (row < 0.0f) return 0;
+    if (row >= static_cast<float>(m_rows - 1)) return m_rows - 1;
+    return static_cast<int>(row);
+}
+
+int SpatialGrid::getCell(float x, float y) const {
+    return clampRow(y) * m_columns + clampColumn(x);
+}
+
+void SpatialGrid::getCellRange(const Aabb& box, int& minColumn, int& minRow, int& maxColumn, int& maxRow) const {
+    minColumn = clampColumn(box.x);
+    minRow = clampRow(box.y);
+    maxColumn = clampColumn(box.x + box.w);
+    maxRow = clampRow(box.y + box.h);
+}
+
+int SpatialGrid::findNearest(float x, float y, int k, uint32_t* indices, float* distances) const {
+    k = static_cast<int>(std::min(static_cast<size_t>(std::max(k, 0)), m_itemCount));
+    if (k == 0) {
+        return 0;
+    }
+    
+    int centerColumn = clampColumn(x);
+    int centerRow = clampRow(y);
+    int maxRing = std::max(std::max(centerColumn, m_columns - 1 - centerColumn),
+                           std::max(centerRow, m_rows - 1 - centerRow));
+    int found = 0;
+    for (int ring = 0; ring <= maxRing; ring++) {
+        // Cells on this ring (Chebyshev distance ring from the center cell)
+        for (int row = centerRow - ring; row <= centerRow + ring; row++) {
+            if (row < 0 || row >= m_rows) {
+                continue;
+            }
+            bool edgeRow = row == centerRow - ring || row == centerRow + ring;
+            int step = edgeRow ? 1 : 2 * ring;
+            for (int column = centerColumn - ring; column <= centerColumn + ring; column += step) {
+                if (column < 0 || column >= m_columns) {
+                    continue;
+                }
+                int cell = row * m_columns + column;
+                for (const uint32_t* item = cellBegin(cell); item != cellEnd(cell); ++item) {
+                    const Aabb& box = m_boxes[*item];
+                    float dx = std::max(std::max(box.x - x, x - (box.x + box.w)), 0.0f);
+                    float dy = std::max(std::max(box.y - y, y - (box.y + box.h)), 0.0f);
+                    float distance = dx * dx + dy * dy;
+                    if (found == k && distance >= distances[k - 1]) {
+                        continue;
+                    }
+                    // Boxes spanning several cells are met more than once
+                    if (std::find(indices, indices + found, *item) != indices + found) {
+                        continue;
+                    }
+                    int slot = found < k ? found++ : k - 1;
+                    while (slot > 0 && distances[slot - 1] > distance) {
+                        indices[slot] = indices[slot - 1];
+                        distances[slot] = distances[slot - 1];
+                        slot--;
+                    }
+                    indices[slot] = *item;
+                    distances[slot] = distance;
+                }
+            }
+        }
+        
+        // Every cell beyond this ring is at least ring * cellSize away
+        float reach = ring * m_cellSize;
+        if (found == k && distances[k - 1] <= reach * reach) {
+            break;
+        }
+    }
+    return found;
+}
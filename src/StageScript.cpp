@@ -0,0 +1,160 @@
+#include "StageScript.h"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// Same flow as the original hard-coded stage:
+// 01 -> 02 -> 03 (loops) -> 04 after 18 kills -> 01 + boss 10s later
+const char* DEFAULT_STAGE_SCRIPT =
+    "0    bg 02\n"
+    "0    random 2.0\n"
+    "16   bg 03\n"
+    "16   itembox on 2.0\n"
+    "24   wave 02 4 line 60 90\n"
+    "40   wave 04 3 column 200 70\n"
+    "52   wave 05 5 v 188 45\n"
+    "60   wait kills 18\n"
+    "60   bg 04\n"
+    "76   bg 01\n"
+    "92   itembox off\n"
+    "92   random 0\n"
+    "102  boss\n";
+
+} // namespace
+
+StageScript::StageScript()
+    : m_cursor(0)
+{
+}
+
+StageScript::~StageScript() {
+}
+
+bool StageScript::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return loadFromString(buffer.str(), path.c_str());
+}
+
+void StageScript::loadDefault() {
+    loadFromString(DEFAULT_STAGE_SCRIPT, "<default>");
+}
+
+bool StageScript::loadFromString(const std::string& text, const char* sourceName) {
+    m_events.clear();
+    m_cursor = 0;
+    
+    std::istringstream input(text);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(input, line)) {
+        lineNumber++;
+        parseLine(line, lineNumber, sourceName);
+    }
+    
+    // Stable sort keeps file order for events with the same time
+    std::stable_sort(m_events.begin(), m_events.end(),
+        [](const StageEvent& a, const StageEvent& b) { return a.time < b.time; });
+    
+    SDL_Log("INFO: Stage script %s compiled (%zu events)", sourceName, m_events.size());
+    return !m_events.empty();
+}
+
+bool StageScript::parseLine(const std::string& line, int lineNumber, const char* sourceName) {
+    std::string content = line.substr(0, line.find('#'));
+    std::istringstream tokens(content);
+    
+    float time;
+    std::string command;
+    if (!(tokens >> time)) {
+        return true;  // Blank or comment-only line
+    }
+    if (!(tokens >> command)) {
+        SDL_Log("WARNING: %s:%d: missing command", sourceName, lineNumber);
+        return false;
+    }
+    
+    StageEvent event = {};
+    event.time = time;
+    
+    if (command == "bg") {
+        int id = 0;
+        if (!(tokens >> id) || id < 1 || id > 4) {
+            SDL_Log("WARNING: %s:%d: bg expects 01-04", sourceName, lineNumber);
+            return false;
+        }
+        event.type = StageEventType::BACKGROUND;
+        event.id = static_cast<uint8_t>(id);
+    } else if (command == "wave") {
+        int type = 0, count = 0;
+        std::string formation;
+        float x = 0.0f, spacing = 0.0f;
+        if (!(tokens >> type >> count >> formation >> x >> spacing) || type < 1 || type > 5 || count < 1 || count > 255) {
+            SDL_Log("WARNING: %s:%d: wave expects <type 01-05> <count> <formation> <x> <spacing>", sourceName, lineNumber);
+            return false;
+        }
+        event.type = StageEventType::WAVE;
+        event.id = static_cast<uint8_t>(type - 1);
+        event.count = static_cast<uint8_t>(count);
+        event.value = x;
+        event.spacing = spacing;
+        if (formation == "single") {
+            event.formation = Formation::SINGLE;
+        } else if (formation == "line") {
+            event.formation = Formation::LINE;
+        } else if (formation == "column") {
+            event.formation = Formation::COLUMN;
+        } else if (formation == "v") {
+            event.formation = Formation::V;
+        } else {
+            SDL_Log("WARNING: %s:%d: unknown formation '%s'", sourceName, lineNumber, formation.c_str());
+            return false;
+        }
+    } else if (command == "random") {
+        float interval = 0.0f;
+        if (!(tokens >> interval) || interval < 0.0f) {
+            SDL_Log("WARNING: %s:%d: random expects <interval>", sourceName, lineNumber);
+            return false;
+        }
+        event.type = StageEventType::RANDOM_SPAWN;
+        event.value = interval;
+    } else if (command == "itembox") {
+        std::string state;
+        tokens >> state;
+        event.type = StageEventType::ITEM_ZONE;
+        if (state == "on") {
+            event.id = 1;
+            event.value = 2.0f;
+            tokens >> event.value;  // Optional interval
+        } else if (state == "off") {
+            event.id = 0;
+        } else {
+            SDL_Log("WARNING: %s:%d: itembox expects on/off", sourceName, lineNumber);
+            return false;
+        }
+    } else if (command == "wait") {
+        std::string condition;
+        int kills = 0;
+        if (!(tokens >> condition >> kills) || condition != "kills") {
+            SDL_Log("WARNING: %s:%d: wait expects 'kills <n>'", sourceName, lineNumber);
+            return false;
+        }
+        event.type = StageEventType::WAIT_KILLS;
+        event.value = static_cast<float>(kills);
+    } else if (command == "boss") {
+        event.type = StageEventType::BOSS;
+    } else {
+        SDL_Log("WARNING: %s:%d: unknown command '%s'", sourceName, lineNumber, command.c_str());
+        return false;
+    }
+    
+    m_events.push_back(event);
+    return true;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Opt-in heap allocation tracking (configure with -DASO_TRACK_ALLOCATIONS=ON).
+// The build then replaces global operator new/delete with counting wrappers.
+// Each allocation is charged to the innermost ALLOCATION_SCOPE on its thread
+// ("untagged" outside any scope), and ALLOCATION_END_FRAME() logs allocations
+// and bytes per frame for every scope about once a second.
+// ALLOCATION_BUDGET(name, n) checks that the rest of the enclosing block
+// allocates at most n times on the calling thread. Violations are counted in
+// the report, and assert as well after ALLOCATION_ASSERT_BUDGETS(true).
+// Without the option every macro compiles to nothing.
+#ifdef ASO_TRACK_ALLOCATIONS
+
+class AllocationTracker {
+public:
+    // name must outlive the program (a string literal); returns a scope id
+    static int registerScope(const char* name);
+
+    static void endFrame();  // Main thread, once per rendered frame
+    static void setAssertOnBudget(bool enabled);
+
+    static uint64_t getThreadAllocationCount();
+    static void reportBudget(int scope, uint64_t used, uint64_t budget);
+};
+
+class AllocationScope {
+public:
+    explicit AllocationScope(int scope);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    int m_previous;
+};
+
+class AllocationBudget {
+public:
+    AllocationBudget(int scope, uint64_t budget);
+    ~AllocationBudget();
+
+    AllocationBudget(const AllocationBudget&) = delete;
+    AllocationBudget& operator=(const AllocationBudget&) = delete;
+
+private:
+    int m_scope;
+    uint64_t m_budget;
+    uint64_t m_start;
+};
+
+#define ALLOCATION_CONCAT_INNER(a, b) a##b
+#define ALLOCATION_CONCAT(a, b) ALLOCATION_CONCAT_INNER(a, b)
+
+#define ALLOCATION_SCOPE(name) \
+    static const int ALLOCATION_CONCAT(allocationScopeId, __LINE__) = AllocationTracker::registerScope(name); \
+    AllocationScope ALLOCATION_CONCAT(allocationScope, __LINE__)(ALLOCATION_CONCAT(allocationScopeId, __LINE__))
+
+#define ALLOCATION_BUDGET(name, count) \
+    static const int ALLOCATION_CONCAT(allocationBudgetId, __LINE__) = AllocationTracker::registerScope(name); \
+    AllocationBudget ALLOCATION_CONCAT(allocationBudget, __LINE__)(ALLOCATION_CONCAT(allocationBudgetId, __LINE__), count)
+
+#define ALLOCATION_END_FRAME() AllocationTracker::endFrame()
+#define ALLOCATION_ASSERT_BUDGETS(enabled) AllocationTracker::setAssertOnBudget(enabled)
+
+#else
+
+#define ALLOCATION_SCOPE(name)
+#define ALLOCATION_BUDGET(name, count)
+#define ALLOCATION_END_FRAME()
+#define ALLOCATION_ASSERT_BUDGETS(enabled) ((void)(enabled))
+
+#endif
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "JobSystem.h"
+#include "SteerDirections.h"
+
+class Game;
+
+// Headless training environment: one game without window or audio, driven by an agent.
+// reset(seed) starts a new game with a seeded RNG, so episodes replay exactly.
+// step(action) holds the action for frameSkip fixed 60 Hz ticks; countdown and
+// explosion ticks (nothing to decide) are run through before the next observation.
+//
+// Actions (ACTION_COUNT): action % MOVE_DIRECTIONS steers (see SteerDirections.h:
+// 0 = hold position, 1-8 = N, NE, E, SE, S, SW, W, NW), action / MOVE_DIRECTIONS holds
+// the missile button.
+// Lasers fire automatically.
+//
+// Observation (OBSERVATION_SIZE floats, positions divided by the field size):
+//   player  center x, y, energy fraction, lives / 3, speed/laser/missile level fractions
+//   enemies nearest NEAREST_ENEMIES: dx, dy from the player, present
+//   bullets nearest NEAREST_BULLETS enemy bullets: dx, dy, vx, vy, present
+//   boss    present, dx, dy to the weak point, health fraction, fighting
+// Empty slots are all zero.
+//
+// Reward: REWARD_PER_POINT per score point, minus LIFE_PENALTY per life lost.
+// done: game over, or maxSteps steps (0 = no limit).
+class AsoEnv {
+public:
+    static const int MOVE_DIRECTIONS = STEER_DIRECTIONS;
+    static const int ACTION_COUNT = MOVE_DIRECTIONS * 2;
+
+    static const int NEAREST_ENEMIES = 8;
+    static const int NEAREST_BULLETS = 16;
+    static const int PLAYER_FEATURES = 7;
+    static const int ENEMY_FEATURES = 3;
+    static const int BULLET_FEATURES = 5;
+    static const int BOSS_FEATURES = 5;
+    static const int OBSERVATION_SIZE = PLAYER_FEATURES + NEAREST_ENEMIES * ENEMY_FEATURES +
+                                        NEAREST_BULLETS * BULLET_FEATURES + BOSS_FEATURES;
+
+    struct StepResult {
+        const float* observation;  // OBSERVATION_SIZE floats, valid until the next reset/step
+        float reward;
+        bool done;
+    };
+
+    explicit AsoEnv(int frameSkip = 4, int maxSteps = 0);
+    ~AsoEnv();
+
+    AsoEnv(const AsoEnv&) = delete;
+    AsoEnv& operator=(const AsoEnv&) = delete;
+
+    const float* reset(uint64_t seed);
+    StepResult step(int action);  // After done, call reset() first
+
+    const float* getObservation() const { return m_observation; }
+    int getScore() const;
+    int getStage() const;
+    int getStepCount() const { return m_steps; }
+    bool isDone() const { return m_done; }
+
+private:
+    void skipUncontrolled();
+    void observe(float* out) const;
+
+    std::unique_ptr<Game> m_game;  // Runs its entity updates inline (no job workers)
+    int m_frameSkip;
+    int m_maxSteps;
+    int m_steps;
+    int m_lastScore;
+    int m_lastLives;
+    bool m_done;
+    float m_observation[OBSERVATION_SIZE];
+};
+
+// K independent AsoEnvs stepped together on a job pool, one env per job.
+// Observations, rewards and done flags are kept in flat arrays indexed by env.
+// A finished env restarts right away with the next seed, so after a done its
+// row already holds the first observation of the new episode.
+class AsoVecEnv {
+public:
+    // threadCount 0 = every hardware thread (the caller runs jobs too)
+    AsoVecEnv(int envCount, int frameSkip = 4, int maxSteps = 0, unsigned threadCount = 0);
+    ~AsoVecEnv();
+
+    // Env i starts from seed + i; later episodes take seed + envCount, seed + envCount + 1, ...
+    void reset(uint64_t seed);
+    void step(const int* actions);  // One action per env
+
+    int getEnvCount() const { return static_cast<int>(m_envs.size()); }
+    const float* getObservations() const { return m_observations.data(); }  // envCount x OBSERVATION_SIZE
+    const float* getRewards() const { return m_rewards.data(); }
+    const uint8_t* getDones() const { return m_dones.data(); }
+    uint64_t getEpisodeCount() const { return m_episodes; }  // Finished episodes since reset()
+
+private:
+    JobSystem m_jobs;
+    std::vector<std::unique_ptr<AsoEnv>> m_envs;
+    std::vector<float> m_observations;
+    std::vector<float> m_rewards;
+    std::vector<uint8_t> m_dones;
+    std::vector<uint64_t> m_nextSeeds;  // Per env, so restarts do not depend on job timing
+    uint64_t m_episodes;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Read-only view of assets.pak, the packed asset archive built by AssetPacker.
+//
+// Layout (little-endian, native structs):
+//   Header
+//   Entry[entryCount]     sorted by nameHash for binary search
+//   data blobs            each aligned to DATA_ALIGNMENT
+// Images are stored pre-decoded as RGBA32 pixels, everything else as the raw
+// file bytes. The file is memory-mapped once; surfaces and RWops handed out
+// point straight into the mapping, so the archive must outlive them.
+// Entries are keyed by file name only: directories in a lookup path are
+// ignored, so getResourcePath() results can be passed in unchanged.
+class AssetArchive {
+public:
+    static const uint32_t MAGIC = 0x4B505341;  // "ASPK"
+    static const uint32_t VERSION = 1;
+    static const uint32_t DATA_ALIGNMENT = 16;
+    static const size_t MAX_NAME_LENGTH = 63;
+
+    enum class AssetType : uint32_t {
+        RAW = 0,    // File bytes (audio, text, ...)
+        IMAGE = 1   // Decoded pixels (width x height, pitch, pixelFormat)
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+
+    struct Entry {
+        uint64_t nameHash;     // hashName() of the file name
+        uint64_t contentHash;  // hash() of the source file bytes
+        uint64_t offset;       // From the start of the archive
+        uint64_t size;         // Bytes of data
+        AssetType type;
+        uint32_t width;        // Images only
+        uint32_t height;
+        uint32_t pitch;
+        uint32_t pixelFormat;  // SDL_PixelFormatEnum
+        uint32_t reserved;
+        char name[MAX_NAME_LENGTH + 1];
+    };
+
+    AssetArchive();
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    // 64-bit FNV-1a
+    static uint64_t hash(const void* data, size_t size);
+    static uint64_t hashName(const std::string& path);  // Hash of the file name part
+    static std::string getFileName(const std::string& path);
+
+    bool open(const std::string& path);  // False (and stays closed) if missing or malformed
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+
+    const Entry* find(const std::string& path) const;
+    const uint8_t* getData(const Entry& entry) const { return m_data + entry.offset; }
+
+    // Surface over the mapped pixels (no copy, must not be written to);
+    // nullptr if the path is not an image in the archive
+    SDL_Surface* createSurface(const std::string& path) const;
+
+    // Read-only stream over the mapped bytes; nullptr if not in the archive
+    SDL_RWops* openRW(const std::string& path) const;
+
+private:
+    bool validate();  // Sets m_entries on success
+
+    const uint8_t* m_data;
+    size_t m_size;
+    const Entry* m_entries;
+    uint32_t m_entryCount;
+#ifdef _WIN32
+    void* m_file;
+    void* m_mapping;
+#endif
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <cstdint>
+#include <string>
+#include "AssetArchive.h"
+
+// Decodes each sound or music file once into PCM in the mixer's output format
+// and keeps the result in a cache file (a plain WAV) named after the source
+// content hash and the mixer spec. Later runs load it with a single read and
+// no codec work into a chunk that owns the PCM. Any failure returns nullptr so
+// the caller can fall back to loading the source directly.
+// loadChunk() is safe to call from several threads.
+class AudioCache {
+public:
+    AudioCache();
+
+    AudioCache(const AudioCache&) = delete;
+    AudioCache& operator=(const AudioCache&) = delete;
+
+    // Call after Mix_OpenAudio; false if the mixer format cannot be cached
+    bool open(const std::string& directory, const AssetArchive* archive);
+    bool isOpen() const { return m_enabled; }
+
+    Mix_Chunk* loadChunk(const std::string& path) const;
+
+private:
+    static const size_t WAV_HEADER_SIZE = 44;
+
+    bool getSourceHash(const std::string& path, uint64_t& hash, void*& fileData, size_t& fileSize) const;
+    std::string getCachePath(uint64_t hash) const;
+    Mix_Chunk* decode(const std::string& path, void* fileData, size_t fileSize) const;
+    uint8_t* readCache(const std::string& cachePath, size_t& pcmSize) const;
+    void writeWavHeader(uint8_t* header, size_t pcmSize) const;
+    void writeCache(const std::string& cachePath, const uint8_t* wav, size_t wavSize) const;
+
+    bool m_enabled;
+    int m_frequency;
+    Uint16 m_format;
+    int m_channels;
+    std::string m_directory;
+    const AssetArchive* m_archive;
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <SDL2/SDL_mixer.h>
+#include <cstdint>
+#include <vector>
+
+// Sound effects the game can trigger
+enum class SoundId : uint8_t {
+    LASER,
+    MISSILE,
+    PICKUP,
+    ITEM_BOX_OPEN,
+    ENEMY_EXPLOSION,
+    BOSS_HIT,
+    PLAYER_DEATH,
+    COUNT
+};
+
+// Owns the mixer channels used for sound effects and decides which triggers get a voice.
+// trigger() only counts requests; flush() runs once per tick and starts at most one voice
+// per sound, louder when several identical triggers landed in the same tick. Each sound
+// has a voice cap (at the cap its oldest voice restarts) and a minimum retrigger interval.
+// When every channel is busy, a sound steals the oldest voice of the lowest priority
+// below its own, otherwise it is dropped.
+// Triggers carry a playfield position: a voice is panned by its x and attenuated by its
+// distance to the listener (the player). Volume, pan and attenuation are applied by one
+// effect callback shared by all effect channels, so starting a voice costs no extra
+// mixer calls beyond Mix_PlayChannel and re-attaching that callback.
+// Simulation thread only.
+class AudioVoiceManager {
+public:
+    AudioVoiceManager();
+
+    // Call after Mix_OpenAudio; the field size sets the pan range and attenuation distance
+    void init(int channelCount, float fieldWidth, float fieldHeight);
+
+    // Higher priority wins channels; volume is 0-128 for a single trigger
+    void registerSound(SoundId sound, Mix_Chunk* chunk, int priority, int maxVoices, float minInterval, int volume);
+
+    // Identical triggers in one tick play once from their average position
+    void trigger(SoundId sound, float x, float y) {
+        int index = static_cast<int>(sound);
+        m_pending[index]++;
+        m_pendingX[index] += x;
+        m_pendingY[index] += y;
+    }
+    void setListener(float x, float y) { m_listenerX = x; m_listenerY = y; }
+    void flush(float deltaTime);
+
+    void stopAll();
+
+private:
+    struct SoundConfig {
+        Mix_Chunk* chunk;
+        int priority;
+        int maxVoices;
+        float minInterval;  // Seconds between voice starts
+        int volume;
+        float lastStart;
+    };
+
+    struct Voice {
+        SoundId sound;
+        int priority;
+        float startTime;
+    };
+
+    // Read by the mixer thread while the channel plays; written with the audio locked
+    struct ChannelGains {
+        float left;
+        float right;
+    };
+
+    int pickChannel(SoundId sound, const SoundConfig& config) const;
+    void computeGains(float x, float y, float volume, ChannelGains& gains) const;
+    static void spatialEffect(int channel, void* stream, int length, void* userData);
+
+    SoundConfig m_sounds[static_cast<int>(SoundId::COUNT)];
+    int m_pending[static_cast<int>(SoundId::COUNT)];
+    float m_pendingX[static_cast<int>(SoundId::COUNT)];  // Position sums of this tick's triggers
+    float m_pendingY[static_cast<int>(SoundId::COUNT)];
+    SoundId m_flushOrder[static_cast<int>(SoundId::COUNT)];  // Highest priority first
+    std::vector<Voice> m_voices;  // Per channel, valid while Mix_Playing()
+    std::vector<ChannelGains> m_gains;  // Per channel, sized once in init()
+    bool m_spatial;  // Effect needs 16-bit stereo; otherwise plain channel volume
+    float m_fieldWidth;
+    float m_fieldHeight;
+    float m_listenerX;
+    float m_listenerY;
+    float m_time;
+};
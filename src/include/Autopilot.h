@@ -0,0 +1,49 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "Player.h"
+#include "Enemy.h"
+#include "Boss.h"
+#include "BulletPool.h"
+#include "PowerUp.h"
+#include "ItemBox.h"
+#include "ObjectPool.h"
+
+// Scripted player for soak and performance runs (--autopilot).
+// Every tick it plans over a short look-ahead: hold, or move in one of eight
+// directions for a sidestep, a longer move or the whole look-ahead, while enemy
+// bullets, enemies and the boss follow their current velocities. The plan with the
+// least danger is steered; ties go to the one that ends closest to the goal: a helpful
+// power-up or revealed item box, otherwise a spot under the boss or the nearest
+// enemy. Missiles are held while anything is there to hit.
+class Autopilot {
+public:
+    struct Command {
+        float targetX, targetY;  // Mouse position to steer toward
+        bool fire;               // Missile button
+    };
+
+    Autopilot();
+
+    void setField(int width, int height);
+    Command update(const Player& player,
+                   const std::vector<std::unique_ptr<Enemy>>& enemies,
+                   const BulletPool& enemyBullets,
+                   const Boss* boss,
+                   const std::vector<ObjectPool<PowerUp>::Ptr>& powerUps,
+                   const std::vector<ObjectPool<ItemBox>::Ptr>& itemBoxes);
+
+private:
+    struct Threat {
+        float x, y;     // Center
+        float vx, vy;   // px/s
+        float radius;   // Touching distance to the player's hitbox center
+        float drift;    // Radius growth (px/s) for movement the velocity does not capture
+    };
+
+    static bool isHelpful(PowerUpType type);
+
+    float m_fieldWidth;
+    float m_fieldHeight;
+    std::vector<Threat> m_threats;  // Scratch, kept for its capacity
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <string>
+#include "RenderSnapshot.h"
+#include "AssetArchive.h"
+
+// Streams background segments from disk so only the ones in use stay in VRAM.
+// Every frame the renderer names the segments it needs (on screen + queued next);
+// missing ones are decoded on a worker thread and uploaded on the render thread,
+// everything else is evicted. Uploaded textures are pre-scaled to the window
+// when render targets are available.
+class BackgroundStreamer {
+public:
+    BackgroundStreamer();
+    ~BackgroundStreamer();
+
+    BackgroundStreamer(const BackgroundStreamer&) = delete;
+    BackgroundStreamer& operator=(const BackgroundStreamer&) = delete;
+
+    // Image file behind a background sprite (call before start)
+    void setPath(SpriteId sprite, const std::string& path);
+    void setArchive(const AssetArchive* archive) { m_archive = archive; }  // Looked up before the file
+
+    void start(SDL_Renderer* renderer, int width, int height);
+    void stop();  // Joins the worker and destroys all textures
+
+    // Render thread, once per frame: keep these resident, evict the rest,
+    // upload finished decodes
+    void retain(const SpriteId* sprites, int count);
+
+    SDL_Texture* getTexture(SpriteId sprite) const;      // nullptr until uploaded
+    bool isMissing(SpriteId sprite) const;              // Image failed to load
+    bool isPrescaled() const { return m_prescale; }     // Textures are window-sized
+    int getResidentCount() const;
+
+    // Render targets were lost: drop every texture, they stream in again on demand
+    void releaseTextures();
+
+private:
+    enum class SlotState : uint8_t {
+        EVICTED,
+        LOADING,   // Queued or decoding on the worker
+        RESIDENT,
+        MISSING    // Load failed, never retried
+    };
+
+    struct Slot {
+        std::string path;
+        SlotState state;
+        SDL_Texture* texture;
+    };
+
+    struct Decoded {
+        SpriteId sprite;
+        SDL_Surface* surface;  // nullptr if the load failed
+    };
+
+    void workerLoop();
+    SDL_Texture* upload(SDL_Surface* surface);
+
+    SDL_Renderer* m_renderer;
+    int m_width;
+    int m_height;
+    bool m_prescale;
+    const AssetArchive* m_archive;  // nullptr or open for the streamer's lifetime
+    Slot m_slots[static_cast<int>(SpriteId::COUNT)];  // State/texture: render thread; paths fixed after start
+
+    std::thread m_worker;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::vector<SpriteId> m_requests;  // Guarded by m_mutex
+    std::vector<Decoded> m_decoded;    // Guarded by m_mutex
+    bool m_stopping;                   // Guarded by m_mutex
+};
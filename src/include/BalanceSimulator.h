@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GameTuning.h"
+#include "JobSystem.h"
+
+class Game;
+
+// Monte Carlo balance runs (--balance): many seeded headless sessions played by
+// the autopilot, spread over every core, one reused Game per job thread.
+// run() plays one tuning and keeps a summary row; writeCsv() writes every row.
+// Session i always starts from seed + i, so tunings are compared on the same games.
+class BalanceSimulator {
+public:
+    struct Options {
+        int sessions = 1000;
+        uint64_t seed = 1;
+        float maxSessionSeconds = 1800.0f;  // Game time; longer sessions are cut off (counted as truncated)
+        unsigned threadCount = 0;           // 0 = every hardware thread (the caller runs jobs too)
+    };
+
+    explicit BalanceSimulator(const Options& options);
+    ~BalanceSimulator();
+
+    BalanceSimulator(const BalanceSimulator&) = delete;
+    BalanceSimulator& operator=(const BalanceSimulator&) = delete;
+
+    void run(const GameTuning& tuning, const std::string& label);
+    bool writeCsv(const std::string& path) const;
+
+    // Sets one GameTuning value by its CSV column name (drop_speed, enemy_cooldown, ...)
+    static bool applySetting(GameTuning& tuning, const std::string& name, float value);
+
+private:
+    struct SessionResult {
+        float survivalSeconds;
+        int score;
+        int kills;
+        int killsToFirstBoss;  // -1: never reached a boss
+        float timeToFirstBoss;
+        int bossesDefeated;
+        int stage;
+        int speedLevel, laserLevel, missileLevel;
+        int pickups;
+        bool truncated;
+    };
+
+    struct Summary {
+        std::string label;
+        GameTuning tuning;
+        int sessions;
+        float survivalMean, survivalP50;
+        float scoreMean, scoreP10, scoreP50, scoreP90;
+        float killsMean;
+        float bossReachedPercent;
+        float killsToBossMean, timeToBossMean;  // Over the sessions that reached a boss
+        float bossesDefeatedMean;
+        int maxStage;
+        float speedLevelMean, laserLevelMean, missileLevelMean;
+        float pickupsMean;
+        int truncated;
+        float wallSeconds;
+    };
+
+    SessionResult playSession(Game& game, const GameTuning& tuning, uint64_t seed) const;
+    static Summary summarize(const std::vector<SessionResult>& results);
+
+    Options m_options;
+    JobSystem m_jobs;
+    std::vector<std::unique_ptr<Game>> m_games;  // One per job thread
+    std::vector<SessionResult> m_results;        // Scratch, indexed by session
+    std::vector<Summary> m_summaries;
+};
@@ -1,5 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <vector>
+#include "RenderSnapshot.h"
 
 class Boss {
 public:
@@ -11,11 +13,10 @@ public:
     };
 
     Boss(float x, float y, int stage);
-    ~Boss();
+    ~Boss() = default;
 
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    void render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect);
+    void draw(std::vector<SpriteDraw>& out, SpriteId sprite) const;
 
     float getX() const { return m_x; }
     float getY() const { return m_y; }
@@ -32,12 +33,9 @@ public:
     float getHitboxHeight() const { return m_height * 0.6f; }
 
     void takeDamage(int damage);
+    void setMaxHealth(int health) { m_health = m_maxHealth = health; }  // Before the fight (tuning)
     bool isOffScreen() const;
     
-    // Shooting
-    bool canShoot() const { return m_shootTimer <= 0.0f; }
-    void resetShootTimer() { m_shootTimer = m_shootCooldown; }
-    
     // Get cannon positions for shooting (12 cannons)
     struct CannonPos {
         float offsetX;
@@ -62,8 +60,6 @@ private:
     BossState m_state;
     
     float m_movementTimer;
-    float m_shootTimer;
-    float m_shootCooldown;
     float m_targetY;  // Target Y position for entering
     
     float m_deathTimer;  // Death animation timer
@@ -14,19 +14,29 @@ public:
     };
 
     Bullet(float x, float y, Owner owner, BulletType type = BulletType::LASER);
-    ~Bullet();
+    Bullet(float x, float y, float velocityX, float velocityY, Owner owner);  // Pattern bullet with free direction
+    ~Bullet() = default;
 
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
+    
+    // Homing missiles turn toward their target (set each tick) at a limited rate;
+    // without one they keep their heading
+    void setHoming(bool homing) { m_homing = homing; }
+    void setTarget(float x, float y) { m_hasTarget = true; m_targetX = x; m_targetY = y; }
+    void clearTarget() { m_hasTarget = false; }
 
     float getX() const { return m_x; }
     float getY() const { return m_y; }
     float getWidth() const { return m_width; }
     float getHeight() const { return m_height; }
+    float getVelocityX() const { return m_vx; }
+    float getVelocityY() const { return m_vy; }
     Owner getOwner() const { return m_owner; }
     BulletType getType() const { return m_type; }
+    bool isHoming() const { return m_homing; }
 
     bool isOffScreen(int windowHeight) const;
+    bool isOffScreen(int windowWidth, int windowHeight) const;
 
 private:
     float m_x, m_y;
@@ -34,6 +44,10 @@ private:
     float m_speed;
     float m_acceleration;  // Missile acceleration
     float m_currentSpeed;  // Current speed (for missiles)
+    float m_vx, m_vy;      // Velocity vector (px/s)
     Owner m_owner;
     BulletType m_type;
+    bool m_homing;
+    bool m_hasTarget;
+    float m_targetX, m_targetY;
 };
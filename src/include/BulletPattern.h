@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include "Boss.h"
+#include "BulletPool.h"
+#include "StateBuffer.h"
+
+// Data-driven bullet patterns for the boss cannons.
+// A BossScript is a set of tracks that run in parallel. Each track drives a group
+// of cannons (bit mask over Boss::getCannonPositions()) through a looping
+// sequence of timed steps. Angles are in degrees, 0 = right, 90 = straight down.
+
+enum class PatternType {
+    STRAIGHT,   // Straight down (classic boss shot)
+    AIMED,      // Toward the player, count bullets spread over spreadDegrees
+    RING,       // Full 360-degree ring of count bullets
+    SPIRAL,     // Ring rotated by spinDegrees every volley
+    FAN         // Arc of spreadDegrees centered straight down
+};
+
+struct PatternStep {
+    PatternType type;
+    int count;            // Bullets per cannon per volley
+    float speed;          // Bullet speed (px/s)
+    float spreadDegrees;  // Total arc for AIMED/FAN
+    float spinDegrees;    // Rotation per volley for SPIRAL
+    int volleys;          // Number of volleys in this step
+    float interval;       // Seconds between volleys
+    float pause;          // Seconds to wait after the last volley
+};
+
+struct PatternTrack {
+    uint16_t cannonMask;  // Bit i set = cannon i fires
+    float startDelay;     // Seconds before the first step
+    const PatternStep* steps;
+    int stepCount;
+};
+
+struct BossScript {
+    const PatternTrack* tracks;
+    int trackCount;
+};
+
+// Scripts cycle every 4 stages, same as boss music
+const BossScript& getBossScript(int stage);
+
+class BulletPatternEngine {
+public:
+    static const int MAX_TRACKS = 4;
+
+    BulletPatternEngine();
+    ~BulletPatternEngine() = default;
+
+    void start(const BossScript& script);
+    void stop() { m_script = nullptr; }
+    bool isRunning() const { return m_script != nullptr; }
+
+    // Advance all tracks and emit bullets from the boss cannons into the pool
+    void update(float deltaTime, const Boss& boss, float targetX, float targetY, BulletPool& bullets);
+
+    // Snapshots store the script by index, not by pointer
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+private:
+    struct TrackState {
+        int step;       // Current step index
+        int volley;     // Volleys fired in current step
+        float timer;    // Time until next volley
+        float angle;    // Accumulated spiral rotation
+    };
+
+    void fireVolley(const PatternStep& step, TrackState& state, uint16_t cannonMask,
+                    const Boss& boss, float targetX, float targetY, BulletPool& bullets);
+
+    const BossScript* m_script;
+    TrackState m_tracks[MAX_TRACKS];
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstddef>
+#include "Bullet.h"
+#include "StateBuffer.h"
+
+// Fixed-capacity bullet store.
+// Bullets live by value in one contiguous array that is reserved up front, so
+// spawning never allocates and removal is a swap with the last element.
+// Order is not preserved (draw order of same-colored bullets does not matter).
+class BulletPool {
+public:
+    explicit BulletPool(size_t capacity = 4096);
+    ~BulletPool();
+
+    // Returns nullptr when the pool is full (the shot is dropped)
+    Bullet* spawn(float x, float y, Bullet::Owner owner, Bullet::BulletType type = Bullet::BulletType::LASER);
+    Bullet* spawn(float x, float y, float velocityX, float velocityY, Bullet::Owner owner);
+
+    void update(float deltaTime);
+    void removeOffScreen(int windowWidth, int windowHeight);
+    void release(size_t index);  // Swap-and-pop; the element at index is replaced by the last one
+    void clear() { m_bullets.clear(); }
+
+    // Snapshots: count then the bullets; loading never exceeds the capacity
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+    // Append every bullet rectangle (drawn later as one batched fill)
+    void draw(std::vector<SDL_Rect>& out) const;
+
+    size_t size() const { return m_bullets.size(); }
+    size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_bullets.empty(); }
+    Bullet& operator[](size_t index) { return m_bullets[index]; }
+    const Bullet& operator[](size_t index) const { return m_bullets[index]; }
+
+    std::vector<Bullet>::iterator begin() { return m_bullets.begin(); }
+    std::vector<Bullet>::iterator end() { return m_bullets.end(); }
+    std::vector<Bullet>::const_iterator begin() const { return m_bullets.begin(); }
+    std::vector<Bullet>::const_iterator end() const { return m_bullets.end(); }
+
+private:
+    std::vector<Bullet> m_bullets;
+    size_t m_capacity;
+    bool m_overflowLogged;
+};
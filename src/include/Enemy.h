@@ -1,5 +1,8 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <memory>
+#include <vector>
+#include "RenderSnapshot.h"
 
 class Enemy {
 public:
@@ -12,16 +15,24 @@ public:
     };
 
     Enemy(float x, float y, EnemyType type, bool isSpecial = false);
-    ~Enemy();
+    ~Enemy() = default;
 
     void update(float deltaTime, float playerX = -1.0f);
-    void render(SDL_Renderer* renderer);
-    void render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect);
+    
+    // Update a contiguous run of enemies that all share one type.
+    // Per-type constants are hoisted and the movement policy is resolved once per batch.
+    static void updateBatch(std::unique_ptr<Enemy>* first, std::unique_ptr<Enemy>* last, float deltaTime, float playerX);
+    
+    // Debug check: batched fast-sine movement vs. the reference std::sin trajectory.
+    // Returns the largest x deviation (pixels) seen over the simulated time.
+    static float validateMovement(float seconds, float deltaTime);
+    void draw(std::vector<SpriteDraw>& out, SpriteId sprite) const;
 
     float getX() const { return m_x; }
     float getY() const { return m_y; }
     float getWidth() const { return m_width; }
     float getHeight() const { return m_height; }
+    float getSpeed() const { return m_speed; }  // Downward, px/s
     bool isSpecial() const { return m_isSpecial; }
     EnemyType getType() const { return m_type; }
     
@@ -36,10 +47,16 @@ public:
     // Shooting
     bool canShoot() const { return m_shootTimer <= 0.0f; }
     void resetShootTimer() { m_shootTimer = m_shootCooldown; }
+    void scaleShootCooldown(float scale) { m_shootTimer *= scale; m_shootCooldown *= scale; }  // At spawn (tuning)
     int getBurstCount() const { return m_burstCount; }
     void decreaseBurstCount() { m_burstCount--; }
 
 private:
+    template <typename Movement>
+    static void updateBatchWith(std::unique_ptr<Enemy>* first, std::unique_ptr<Enemy>* last, float deltaTime, float playerX);
+    
+    void updateShootTimer(float deltaTime, int burstCount);
+
     float m_x, m_y;
     float m_width, m_height;
     float m_speed;
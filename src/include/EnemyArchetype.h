@@ -0,0 +1,93 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include "Enemy.h"
+#include "FastMath.h"
+
+// Compile-time enemy archetypes.
+// One row per Enemy::EnemyType holding stats, the horizontal movement policy
+// and the sprite slot. Enemy and Game read this table instead of switching on type.
+
+// Horizontal movement policies: step() returns the new x.
+// Used as template policies for batched updates and as function pointers otherwise.
+// stepBatch() moves a packed array of enemies; the loops are branch-free so the
+// compiler can vectorize them.
+struct ChaseMovement {
+    static float step(float x, float /*timer*/, float horizontalSpeed, float /*frequency*/, float deltaTime, float playerX) {
+        // Drift toward the player (no drift while player position is unknown)
+        float direction = (playerX > x) ? 1.0f : -1.0f;
+        float active = (playerX >= 0.0f) ? 1.0f : 0.0f;
+        return x + horizontalSpeed * direction * active * deltaTime;
+    }
+    
+    static void stepBatch(float* x, const float* /*timer*/, int count, float horizontalSpeed, float /*frequency*/, float deltaTime, float playerX) {
+        float drift = (playerX >= 0.0f) ? horizontalSpeed * deltaTime : 0.0f;
+        for (int i = 0; i < count; i++) {
+            x[i] += (playerX > x[i]) ? drift : -drift;
+        }
+    }
+};
+
+struct ZigzagMovement {
+    static float step(float x, float timer, float horizontalSpeed, float frequency, float deltaTime, float /*playerX*/) {
+        return x + horizontalSpeed * FastMath::sin(timer * frequency) * deltaTime;
+    }
+    
+    static void stepBatch(float* x, const float* timer, int count, float horizontalSpeed, float frequency, float deltaTime, float /*playerX*/) {
+        float amplitude = horizontalSpeed * deltaTime;
+        for (int i = 0; i < count; i++) {
+            x[i] += amplitude * FastMath::sin(timer[i] * frequency);
+        }
+    }
+};
+
+typedef float (*MovementFn)(float x, float timer, float horizontalSpeed, float frequency, float deltaTime, float playerX);
+
+enum class MovementKind : uint8_t {
+    CHASE,
+    ZIGZAG
+};
+
+// Enemy sprite slots (order of enemy_01.png ~ enemy_05.png)
+enum class EnemySprite : uint8_t {
+    ENEMY_01,
+    ENEMY_02,
+    ENEMY_03,
+    ENEMY_04,
+    ENEMY_05,
+    COUNT
+};
+
+struct EnemyArchetype {
+    float speed;            // Downward speed
+    float horizontalSpeed;  // Horizontal speed (zigzag amplitude or drift speed)
+    float frequency;        // Zigzag angular frequency (rad/s), unused for chase
+    float shootCooldown;    // Seconds between shots (or bursts)
+    int burstCount;         // Bullets per burst (0 = single shots)
+    MovementKind movement;
+    MovementFn move;
+    EnemySprite sprite;
+};
+
+constexpr int ENEMY_TYPE_COUNT = 5;
+
+constexpr EnemyArchetype ENEMY_ARCHETYPES[ENEMY_TYPE_COUNT] = {
+    //  speed   hSpeed  freq   cooldown burst  movement              move                   sprite
+    // TYPE_01: slow, drifts toward player, 1.5s shots
+    { 100.0f,  30.0f,  0.0f,   1.5f,   0, MovementKind::CHASE,  &ChaseMovement::step,  EnemySprite::ENEMY_01 },
+    // TYPE_02: normal speed, large zigzag, 1s shots
+    { 150.0f, 150.0f,  3.0f,   1.0f,   0, MovementKind::ZIGZAG, &ZigzagMovement::step, EnemySprite::ENEMY_02 },
+    // TYPE_03: special item carrier, larger zigzag, never shoots
+    { 120.0f,  90.0f,  2.0f, 999.0f,   0, MovementKind::ZIGZAG, &ZigzagMovement::step, EnemySprite::ENEMY_03 },
+    // TYPE_04: fast, drifts toward player, 0.7s shots
+    { 200.0f,  50.0f,  0.0f,   0.7f,   0, MovementKind::CHASE,  &ChaseMovement::step,  EnemySprite::ENEMY_04 },
+    // TYPE_05: very wide zigzag, 3-bullet bursts every 1.3s
+    { 130.0f, 210.0f,  2.5f,   1.3f,   3, MovementKind::ZIGZAG, &ZigzagMovement::step, EnemySprite::ENEMY_05 },
+};
+
+constexpr const EnemyArchetype& getArchetype(Enemy::EnemyType type) {
+    return ENEMY_ARCHETYPES[static_cast<int>(type)];
+}
+
+static_assert(static_cast<int>(Enemy::EnemyType::TYPE_05) + 1 == ENEMY_TYPE_COUNT, "Archetype table must cover every EnemyType");
+static_assert(getArchetype(Enemy::EnemyType::TYPE_05).burstCount == 3, "TYPE_05 fires 3-bullet bursts");
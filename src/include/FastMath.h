@@ -0,0 +1,31 @@
+#pragma once
+#include <cmath>
+
+// Branch-free polynomial sine for hot per-frame movement loops.
+// Range-reduced to [-pi/2, pi/2] and evaluated with a degree-9 odd polynomial,
+// max error ~1e-5 for the argument range enemy and boss timers reach.
+// Small enough to inline and auto-vectorize inside batch loops.
+
+namespace FastMath {
+
+const float PI = 3.14159265358979f;
+const float HALF_PI = 1.57079632679490f;
+const float TWO_PI = 6.28318530717959f;
+const float INV_TWO_PI = 0.159154943091895f;
+
+inline float sin(float x) {
+    // Wrap to [-pi, pi] (round to nearest turn via int truncation, vectorizes on plain SSE2)
+    float turns = x * INV_TWO_PI;
+    turns += (turns >= 0.0f) ? 0.5f : -0.5f;
+    x -= TWO_PI * static_cast<float>(static_cast<int>(turns));
+    
+    // Fold to [-pi/2, pi/2] using sin(pi - x) = sin(x)
+    float folded = ((x >= 0.0f) ? PI : -PI) - x;
+    x = (x > HALF_PI || x < -HALF_PI) ? folded : x;
+    
+    // Taylor series up to x^9 (Horner form)
+    float x2 = x * x;
+    return x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+}
+
+} // namespace FastMath
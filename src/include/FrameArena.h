@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+// Bump allocator for data that lives at most one tick or frame.
+// allocate() moves a pointer through one block, deallocate() does nothing, and
+// reset() rewinds everything at once. When a frame needs more than the block,
+// the excess comes from the heap and the next reset() grows the block to the
+// high-water mark, so after warm-up every frame is served from a single block
+// and long sessions never fragment.
+// Use through std::pmr containers: std::pmr::vector<T> items(&arena).
+// Anything allocated must be gone before reset(). One thread per arena.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    explicit FrameArena(size_t capacity = 64 * 1024);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void reset();
+
+    size_t getCapacity() const { return m_capacity; }
+    size_t getHighWater() const { return m_highWater; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    std::unique_ptr<std::byte[]> m_block;
+    size_t m_capacity;
+    size_t m_offset;
+    size_t m_overflowBytes;  // Served from the heap this frame
+    size_t m_highWater;      // Most bytes any frame has needed
+    std::vector<std::pair<void*, size_t>> m_overflow;  // Heap blocks to free on reset (pointer, alignment)
+};
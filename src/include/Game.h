@@ -6,12 +6,33 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstring>
 #include "Player.h"
 #include "Enemy.h"
 #include "Boss.h"
 #include "Bullet.h"
+#include "BulletPool.h"
+#include "BulletPattern.h"
 #include "PowerUp.h"
 #include "ItemBox.h"
+#include "ObjectPool.h"
+#include "FrameArena.h"
+#include "Random.h"
+#include "StageScript.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+#include "JobSystem.h"
+#include "SpatialGrid.h"
+#include "BackgroundStreamer.h"
+#include "AssetArchive.h"
+#include "AudioCache.h"
+#include "AudioVoiceManager.h"
+#include "MusicController.h"
+#include "Autopilot.h"
+#include "GameTuning.h"
 
 class Game {
 public:
@@ -21,46 +42,184 @@ public:
         COUNTDOWN,
         PLAYING,
         PAUSED,
+        EXPLODING,  // Player explosion animation (world frozen)
         GAME_OVER
     };
 
-    Game();
+    // Per-session counters for bots and batch runs (cleared by every new game)
+    struct SessionStats {
+        float playTime;          // Seconds spent PLAYING
+        int kills;
+        int killsToFirstBoss;    // -1 until the first boss appears
+        float timeToFirstBoss;   // Play time when it appeared
+        int bossesDefeated;
+        int livesLost;
+        int pickups;             // Power-ups and item boxes collected
+        int maxSpeedLevel, maxLaserLevel, maxMissileLevel;
+    };
+
+    enum class ResetKind {
+        NEW_GAME,   // Start or retry: stage 1, fresh player, lives and score reset
+        RESPAWN,    // Lost a life: field cleared, boss and stage progress kept
+        GAME_OVER   // Out of lives: field and boss cleared, score kept for the results
+    };
+
+    // Playfield the game is laid out for: the window, and headless runs
+    static const int FIELD_WIDTH = 437;
+    static const int FIELD_HEIGHT = 778;
+
+    // jobWorkers: threads for parallel entity updates (0 = run them on the calling thread)
+    explicit Game(unsigned jobWorkers = JobSystem::defaultWorkerCount());
     ~Game();
 
     bool init(const char* title, int width, int height);
-    void handleEvents();
-    void update(float deltaTime);
-    void render();
+    
+    // Simulation only: no window, renderer, audio or high score file, and update()
+    // publishes no snapshots. Drive it with update() (see AsoEnv).
+    bool initHeadless(int width, int height, uint64_t seed);
+    void handleEvents();   // Main thread: polls SDL and queues input for the simulation
+    void update(float deltaTime);  // Simulation: applies queued input, steps, publishes a snapshot
+    void render();         // Main thread: draws the newest published snapshot
     void clean();
+    
+    // Run update() on a dedicated thread at a fixed step
+    void startSimulationThread(float stepSeconds);
+    void stopSimulationThread();
+    
+    // Whole simulation state (entities, timers, stage, backgrounds, RNG) as a flat buffer.
+    // Call between ticks: on the simulation thread or with it stopped.
+    // A buffer only restores into the build that saved it.
+    void saveState(std::vector<uint8_t>& out) const;
+    bool restoreState(const std::vector<uint8_t>& data);
+    
+    // Scripted player (after init): steers, fires and starts every new game by itself.
+    // Call before startSimulationThread().
+    void setAutopilot(bool enabled);
+    
+    // One log line with progress and container/pool sizes (soak runs)
+    void logStatus() const;
+    
+    // Balance values for the sessions that follow (see GameTuning)
+    void setTuning(const GameTuning& tuning);
+    
+    // Headless: start a new game from this seed right away, skipping the title screen
+    void startSession(uint64_t seed);
+    
+    bool isGameOver() const { return m_gameState == GameState::GAME_OVER; }
+    int getScore() const { return m_score; }
+    int getStage() const { return m_currentStage; }
+    const SessionStats& getSessionStats() const { return m_sessionStats; }
 
     bool isRunning() const { return m_running; }
-    int getWindowWidth() const { int w; SDL_GetWindowSize(m_window, &w, nullptr); return w; }
-    int getWindowHeight() const { int h; SDL_GetWindowSize(m_window, nullptr, &h); return h; }
+    int getWindowWidth() const { return m_windowWidth; }
+    int getWindowHeight() const { return m_windowHeight; }
 
 private:
+    friend class AsoEnv;  // Reads entities for observations and drives input directly
+    
     SDL_Window* m_window;
     SDL_Renderer* m_renderer;
-    bool m_running;
+    AssetArchive m_assets;  // assets.pak if present (outlives everything loaded from it)
+    AudioCache m_audioCache;  // Decoded PCM of sounds and music, reused across runs
+    std::atomic<bool> m_running;
+    int m_windowWidth;   // Cached at init (window is not resizable)
+    int m_windowHeight;
+    bool m_headless;     // Set by initHeadless()
+    
+    // Input handed from the event thread to the simulation
+    enum class InputCommand : uint8_t {
+        MOUSE_MOVE,
+        MOUSE_DOWN,
+        MOUSE_UP,
+        TOGGLE_PAUSE,
+        KEY_START,
+        QUICK_SAVE,
+        QUICK_LOAD
+    };
+    struct InputEvent {
+        InputCommand command;
+        float x, y;
+    };
+    std::mutex m_inputMutex;
+    std::vector<InputEvent> m_inputQueue;    // Filled by handleEvents (guarded)
+    std::vector<InputEvent> m_inputPending;  // Drained by the simulation
+    
+    // Simulation thread and render snapshots
+    std::thread m_simulationThread;
+    std::atomic<bool> m_simulationRunning;
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    uint32_t m_simulationTick;
+    SDL_Texture* m_sprites[static_cast<int>(SpriteId::COUNT)];  // SpriteId -> texture (render thread)
+    
+    // Parallel entity updates. Enemy shots are queued per job thread and spawned
+    // in entity order by mergeWorkerCommands(), so the result does not depend on
+    // how chunks were scheduled.
+    struct QueuedShot {
+        uint32_t order;  // Entity index (an enemy fires at most once per tick)
+        float x, y;
+    };
+    struct WorkerCommands {
+        std::vector<QueuedShot> enemyShots;
+        
+        void shoot(uint32_t order, float x, float y) { enemyShots.push_back({order, x, y}); }
+    };
+    JobSystem m_jobs;
+    std::vector<WorkerCommands> m_workerCommands;  // One per job thread
+    
+    // Collision broadphase grid; narrowphase runs per cell on the job threads
+    struct Contact {
+        uint32_t a, b;  // Sort key: bullet index, then target index
+        int value;      // Damage (boss contacts)
+    };
+    SpatialGrid m_bulletGrid;  // Player bullets
+    SpatialGrid m_enemyGrid;   // Enemies (same bounds as m_bulletGrid)
+    SpatialGrid m_targetGrid;  // Homing missile targets: hidden item boxes, then the boss weak point
+    std::vector<std::vector<Contact>> m_threadContacts;  // One per job thread
+    
+    // Scratch that lives one tick (simulation thread) or one frame (render thread).
+    // Not for job threads or anything published in a snapshot.
+    FrameArena m_tickArena;
+    FrameArena m_frameArena;
+    
     bool m_mouseGrabbed;  // Mouse lock state
     bool m_mousePressed;  // Mouse button pressed state
     float m_missileShootTimer;  // Missile shoot cooldown timer
     const float m_missileShootCooldown = 1.0f;  // Missile shoots every 1.0 second (2x slower than laser)
 
     std::unique_ptr<Player> m_player;
-    std::vector<std::unique_ptr<Enemy>> m_enemies;
+    std::vector<std::unique_ptr<Enemy>> m_enemies;  // Grouped by type (see addEnemy)
     std::unique_ptr<Boss> m_boss;  // Current boss
     std::vector<std::unique_ptr<Bullet>> m_bullets;
-    std::vector<std::unique_ptr<Bullet>> m_enemyBullets;  // Enemy bullets
-    std::vector<std::unique_ptr<PowerUp>> m_powerUps;
-    std::vector<std::unique_ptr<ItemBox>> m_itemBoxes;  // Item boxes
+    BulletPool m_enemyBullets;  // Enemy bullets (pooled, value storage)
+    BulletPatternEngine m_bossPattern;  // Boss cannon bullet patterns
+    ObjectPool<PowerUp> m_powerUpPool;  // Must outlive m_powerUps
+    ObjectPool<ItemBox> m_itemBoxPool;  // Must outlive m_itemBoxes
+    size_t m_stagePoolBlocks;           // Pool blocks after the stage's reserve() (0 = not reserved yet)
+    size_t m_poolGrowthBlocks;          // Blocks the pools grew by mid-stage, over the whole run
+    std::vector<ObjectPool<PowerUp>::Ptr> m_powerUps;
+    std::vector<ObjectPool<ItemBox>::Ptr> m_itemBoxes;  // Item boxes
+    Random m_random;  // Every simulation roll goes through this (part of snapshots)
+    std::vector<uint8_t> m_quickSave;  // F5 saves, F9 loads (simulation thread)
+    Autopilot m_autopilot;
+    bool m_autopilotEnabled;
+    float m_autopilotIdleTimer;  // Time spent on the title or results screen
+    int m_sessionCount;          // Games started since launch
+    SessionStats m_sessionStats;
+    GameTuning m_tuning;
 
     float m_enemySpawnTimer;
-    const float m_enemySpawnInterval = 2.0f;
-    int m_enemyKillCount;  // Count enemies killed to trigger boss
+    float m_enemySpawnInterval;  // Random spawn interval (0 = off, set by stage script)
+    int m_enemyKillCount;  // Count enemies killed (stage script waits on it)
     int m_currentStage;    // Current stage number
     
+    // Stage timeline (waves, backgrounds, item zones, boss trigger)
+    StageScript m_stageScript;
+    float m_stageTime;  // Stage clock (paused during waits and boss fight)
+    
     GameState m_gameState;
     float m_stateTimer;
+    float m_explosionTimer;  // Time into the player explosion (EXPLODING)
+    float m_explosionX, m_explosionY;  // Explosion center
     
     int m_lives;
     int m_score;
@@ -69,37 +228,24 @@ private:
     
     Mix_Chunk* m_shootSound;
     Mix_Chunk* m_explosionSound;
-    Mix_Music* m_bgMusic;  // Background music (default: aso_plus_opening2.wav)
-    Mix_Music* m_stage01Music;  // Stage 1 music
-    Mix_Music* m_stage02Music;  // Stage 2 music
-    Mix_Music* m_boss01Music;  // Boss 1 music
-    Mix_Music* m_boss02Music;  // Boss 2 music
-    Mix_Music* m_boss03Music;  // Boss 3 music
-    Mix_Music* m_boss04Music;  // Boss 4 music
-    
-    SDL_Texture* m_backgroundTexture;  // Background texture (legacy)
-    SDL_Texture* m_background01Texture;  // Background 01
-    SDL_Texture* m_background02Texture;  // Background 02
-    SDL_Texture* m_background03Texture;  // Background 03
-    SDL_Texture* m_background04Texture;  // Background 04
-    
-    // Background scrolling slots (two textures scrolling)
-    SDL_Texture* m_bgSlot1Texture;  // Top background slot
-    SDL_Texture* m_bgSlot2Texture;  // Bottom background slot
+    Mix_Chunk* m_bossHitSound;  // metal_collision.mp3 (optional)
+    AudioVoiceManager m_soundVoices;  // All sound effects go through here
+    MusicController m_music;  // Title, stage and boss tracks with crossfades
+    
+    BackgroundStreamer m_backgroundStreamer;  // background.png (legacy) and background01-04, streamed on demand
+    
+    // Background scrolling slots (two backgrounds scrolling)
+    SpriteId m_bgSlot1;  // Top background slot
+    SpriteId m_bgSlot2;  // Bottom background slot
     float m_backgroundY1;  // First background position
     float m_backgroundY2;  // Second background position
     float m_backgroundScrollSpeed;  // Scroll speed
     
-    // Background sequence tracking
-    int m_bgSequenceIndex;  // Current position in sequence (0=01, 1=02, 2=03, 3=03repeat, 4=04, 5=01boss)
-    int m_bg03LoopCount;  // How many times bg03 has looped
-    int m_maxBg03Loops;  // Maximum loops for bg03 before switching to bg04
-    SDL_Texture* m_currentSequenceTexture;  // Currently active texture in sequence
-    SDL_Texture* m_nextSequenceTexture;  // Next texture to be loaded
-    float m_bossSpawnTimer;  // Timer for boss spawn after bg04
-    bool m_bg04Completed;  // Whether bg04 has been completed
-    float m_itemBoxSpawnTimer;  // Timer for spawning item boxes in space city
-    bool m_inSpaceCity;  // Whether currently in space city section (bg02-04)
+    // Background sequence (driven by stage script "bg" events)
+    SpriteId m_nextSequenceSprite;  // Background used when a slot wraps (repeats until changed)
+    float m_itemBoxSpawnTimer;  // Timer for spawning item boxes in item zone
+    float m_itemBoxSpawnInterval;  // Item box spawn interval
+    bool m_itemZoneActive;  // Whether an item box zone is active (space city)
     
     SDL_Texture* m_playerTexture;  // ship_01.png (legacy)
     SDL_Texture* m_shipStopTexture;  // ship_stop.png
@@ -133,9 +279,39 @@ private:
     SDL_Texture* m_titleTexture;  // Title texture
     
     SDL_Texture* m_startLogoTexture;  // Start logo texture
+    
+    // HUD layer: redrawn into a render target only when a value changes
+    struct HudValues {
+        int score, highScore, lives;
+        int speedCount, speedLevel;
+        int laserCount, laserLevel;
+        int missileCount, missileLevel;
+        int energy, maxEnergy;
+        
+        bool operator!=(const HudValues& other) const { return std::memcmp(this, &other, sizeof(HudValues)) != 0; }
+    };
+    SDL_Texture* m_hudTexture;  // nullptr if render targets are unsupported
+    HudValues m_hudValues;      // Values currently drawn into m_hudTexture
+    bool m_hudDirty;            // Force a redraw (first frame, lost render targets)
+    
+    // 7-segment digits 0-9 pre-drawn in white, one strip per digit size (tinted when drawn)
+    struct DigitStrip {
+        int digitWidth, digitHeight;
+        SDL_Texture* texture;  // nullptr if it could not be created (draw segments directly)
+    };
+    std::vector<DigitStrip> m_digitStrips;
+    
+    // Streamed backgrounds (pre-scaled to the window) composed as upper slot over
+    // lower slot into a two-screen strip; scrolling is one unscaled source-rect copy
+    SDL_Texture* m_backgroundStrip;  // W x 2H target, nullptr if render targets are unsupported
+    SpriteId m_stripUpper;           // Backgrounds currently composed into the strip
+    SpriteId m_stripLower;
+    bool m_backgroundsPrepared;      // False until first render and after lost render targets
     float m_blinkTimer;  // Blink timer
     Uint8 m_fadeAlpha;  // Fade alpha value (0-255)
     
+    void checkLaserEnemyCollision();
+    void mergeContacts(std::pmr::vector<Contact>& merged);
     void checkPlayerEnemyCollision();
     void checkPlayerEnemyBulletCollision();
     void checkPlayerBossCollision();
@@ -143,17 +319,52 @@ private:
     void checkPowerUpCollection();
     void checkItemBoxCollection();
     void checkMissileItemBoxCollision();
+    void checkPoolAllocations();
+    bool buildMissileTargets();
+    void aimMissile(Bullet& missile) const;
     void spawnItemBoxes();
     void dropPowerUp(float x, float y);
     void damagePlayer();
+    void finishPlayerExplosion();
+    void resetSession(ResetKind kind);
+    template <typename Visitor>
+    void visitSimulationValues(Visitor&& visit);
     void spawnBoss(int stage);
-    void renderUI();
-    void renderStartScreen();
-    void renderMenu();
-    void renderCountdown();
-    void renderGameOver();
+    void loadStageScript(int stage);
+    SDL_Surface* loadImage(const std::string& path);
+    Mix_Chunk* loadSound(const std::string& path);
+    void updateStageTimeline(float deltaTime);
+    void applyStageEvent(const StageEvent& event);
+    void spawnWave(const StageEvent& event);
+    void addEnemy(std::unique_ptr<Enemy> enemy);
+    void updateEnemyRange(size_t begin, size_t end, float deltaTime, float playerX, WorkerCommands& commands);
+    void mergeWorkerCommands();
+    SpriteId getBackgroundSprite(int id) const;
+    void applyInput();
+    void applyAutopilot(float deltaTime);
+    void updateSimulation(float deltaTime);
+    void simulationLoop(float stepSeconds);
+    void buildSnapshot(RenderSnapshot& snapshot);
+    void buildSpriteTable();
+    void drawSprites(const std::vector<SpriteDraw>& sprites);
+    void drawRectBatch(const RectBatch& batch);
+    void renderWorld(const RenderSnapshot& snapshot);
+    void renderUI(const RenderSnapshot& snapshot);
+    void drawHud(const HudValues& hud);
+    void renderStartScreen(const RenderSnapshot& snapshot);
+    void renderMenu(const RenderSnapshot& snapshot);
+    void renderCountdown(const RenderSnapshot& snapshot);
+    void renderGameOver(const RenderSnapshot& snapshot);
+    void renderExplosion(const RenderSnapshot& snapshot);
     void draw7SegmentDigit(int digit, int x, int y, int width, int height, SDL_Color color);
     void draw7SegmentNumber(int number, int x, int y, int digitWidth, int digitHeight, int spacing, SDL_Color color);
+    SDL_Texture* getDigitStrip(int digitWidth, int digitHeight);
+    void releaseDigitStrips();
+    void prepareBackgrounds();
+    void releaseBackgrounds();
+    SpriteId resolveBackground(SpriteId sprite) const;
+    void renderBackground(const RenderSnapshot& snapshot);
+    static int formatDigits(int number, int* digits);
     void drawNumber(int number, int x, int y, int scale);
     void saveHighScores();
     void loadHighScores();
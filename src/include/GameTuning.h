@@ -0,0 +1,26 @@
+#pragma once
+
+// Power-up drop categories rolled by Game::dropPowerUp (special enemy kills)
+enum class DropCategory {
+    SPEED,
+    LASER,
+    MISSILE,
+    ENERGY,   // Small, medium or large, evenly
+    BONUS,
+    ONE_UP,
+    VOLTAGE,
+    KEEP,     // Keep speed, laser or missile, evenly
+    PENALTY,  // Speed, laser, missile or energy down, evenly
+    COUNT
+};
+
+// Hand-tuned balance values, gathered so batch runs can sweep them (--balance).
+// The defaults are the shipped game.
+struct GameTuning {
+    // Relative drop weights per DropCategory (the defaults sum to 100)
+    int dropWeights[static_cast<int>(DropCategory::COUNT)] = {20, 20, 20, 10, 10, 5, 5, 5, 5};
+    float enemyCooldownScale = 1.0f;  // Multiplies every enemy type's time between shots
+    float bossHealthScale = 1.0f;     // Multiplies boss HP (100)
+    int bossHitDamage = 1;            // Damage per player bullet on the boss body
+    int weakPointDamage = 5;          // Damage per player bullet on the weak point
+};
@@ -1,5 +1,8 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <vector>
+#include "RenderSnapshot.h"
+#include "Random.h"
 
 class ItemBox {
 public:
@@ -11,11 +14,11 @@ public:
     };
 
     ItemBox(float x, float y);
-    ~ItemBox();
+    ~ItemBox() = default;
 
-    void reveal();  // Called when hit by missile
+    void reveal(Random& random);  // Called when hit by missile
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer, SDL_Texture* boxTexture, SDL_Texture* sTexture, SDL_Texture* lTexture, SDL_Texture* mTexture);
+    void draw(std::vector<SpriteDraw>& out) const;
 
     float getX() const { return m_x; }
     float getY() const { return m_y; }
@@ -0,0 +1,96 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+// Work-stealing thread pool for data-parallel loops.
+// parallelFor() cuts an index range into chunks, deals them round-robin onto
+// per-thread queues and lets idle threads steal from the others. The calling
+// thread takes part as thread 0, so a pool with no workers runs inline.
+// One parallelFor at a time; jobs must not call parallelFor themselves.
+class JobSystem {
+public:
+    explicit JobSystem(unsigned workerCount = defaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Hardware threads minus the caller and the render thread
+    static unsigned defaultWorkerCount();
+    
+    // Workers for a pool of threadCount threads, the caller included (0 = every hardware thread)
+    static unsigned workerCountFor(unsigned threadCount);
+
+    // Threads that can run jobs (workers + caller); size per-thread buffers with this
+    unsigned getThreadCount() const { return m_threadCount; }
+
+    // Calls fn(begin, end, threadIndex) over [0, count) in chunks of at least grain.
+    // Returns when every chunk has run.
+    template <typename Fn>
+    void parallelFor(size_t count, size_t grain, Fn&& fn);
+
+private:
+    struct Task {
+        void (*invoke)(void* context, size_t begin, size_t end, unsigned thread);
+        void* context;
+        std::atomic<size_t> remaining;  // Chunks not finished yet
+    };
+
+    struct Job {
+        Task* task;
+        size_t begin, end;
+    };
+
+    // Owner pops newest from the back, thieves take oldest from the front
+    static const size_t QUEUE_CAPACITY = 64;
+    struct WorkQueue {
+        std::mutex mutex;
+        Job jobs[QUEUE_CAPACITY];
+        size_t head = 0;  // Oldest job
+        size_t size = 0;
+    };
+
+    void run(Task& task, size_t count, size_t grain);
+    bool push(unsigned thread, const Job& job);
+    bool popOrSteal(unsigned thread, Job& job);
+    void execute(const Job& job, unsigned thread);
+    void workerLoop(unsigned thread);
+
+    unsigned m_threadCount;  // Fixed before any worker starts
+    std::vector<std::thread> m_workers;
+    std::unique_ptr<WorkQueue[]> m_queues;  // One per thread, index 0 = caller
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::atomic<size_t> m_queuedJobs;  // Pushed and not yet taken
+    std::atomic<bool> m_stopping;
+};
+
+template <typename Fn>
+void JobSystem::parallelFor(size_t count, size_t grain, Fn&& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    
+    // Small ranges (or no workers): not worth waking anybody
+    if (m_threadCount == 1 || count <= grain) {
+        fn(static_cast<size_t>(0), count, 0u);
+        return;
+    }
+    
+    typedef typename std::remove_reference<Fn>::type Function;
+    Task task;
+    task.invoke = [](void* context, size_t begin, size_t end, unsigned thread) {
+        (*static_cast<Function*>(context))(begin, end, thread);
+    };
+    task.context = const_cast<void*>(static_cast<const void*>(&fn));
+    run(task, count, grain);
+}
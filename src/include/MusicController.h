@@ -0,0 +1,120 @@
+#pragma once
+#include <SDL2/SDL_mixer.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class MusicTrack : uint8_t {
+    NONE,      // Silence
+    TITLE,     // aso_plus_opening2.wav, also the stage fallback
+    STAGE_01,
+    STAGE_02,
+    BOSS_01,
+    BOSS_02,
+    BOSS_03,
+    BOSS_04,
+    COUNT
+};
+
+// Background music without blocking the game thread.
+// Tracks are decoded to PCM chunks on a loader thread (prepare() ahead of time)
+// and mixed into the output by a MIX_CHANNEL_POST effect, which crossfades
+// between two decks. The game thread only exchanges small commands with the
+// audio callback through a lock-free ring, and frees tracks once the callback
+// has stopped using them, so at most the current, fading and prepared tracks
+// stay resident.
+class MusicController {
+public:
+    using Loader = std::function<Mix_Chunk*(const std::string& path)>;  // Called on the loader thread
+
+    MusicController();
+    ~MusicController();
+
+    MusicController(const MusicController&) = delete;
+    MusicController& operator=(const MusicController&) = delete;
+
+    // Before start(); a missing track plays its fallback instead
+    void setTrack(MusicTrack track, const std::string& path, MusicTrack fallback);
+
+    // Call after Mix_OpenAudio; false if the mixer format is not 16-bit
+    bool start(Loader loader);
+    void stop();  // Unregisters the effect, joins the loader, frees every track
+
+    // Game thread. prepare() starts loading in the background; play() crossfades
+    // to the track after delaySeconds, or as soon as it is loaded if later
+    void prepare(MusicTrack track);
+    void play(MusicTrack track, int volume, float fadeSeconds, float delaySeconds = 0.0f);
+    void update(float deltaTime);
+
+private:
+    enum class TrackState : uint8_t { UNLOADED, LOADING, READY, MISSING };
+
+    struct Track {
+        std::string path;
+        MusicTrack fallback;
+        TrackState state;
+        Mix_Chunk* chunk;
+    };
+
+    // Game thread -> audio callback
+    struct Command {
+        const Mix_Chunk* chunk;  // nullptr fades to silence
+        float volume;            // 0-1
+        uint32_t fadeFrames;
+    };
+
+    // Audio callback state
+    struct Deck {
+        const Mix_Chunk* chunk;
+        uint32_t position;  // Sample index
+        float volume;
+    };
+
+    static void postEffect(int channel, void* stream, int length, void* userData);
+    void mix(int16_t* samples, int count);
+    void loaderLoop();
+    MusicTrack resolve(MusicTrack track) const;
+    void releaseUnused();
+
+    static const uint32_t COMMAND_CAPACITY = 8;
+
+    Track m_tracks[static_cast<int>(MusicTrack::COUNT)];  // Game thread
+    bool m_started;
+    int m_frequency;
+    int m_channels;
+
+    // Pending play() request (game thread)
+    MusicTrack m_target;
+    int m_targetVolume;
+    float m_targetFade;
+    float m_targetDelay;
+    bool m_targetPending;
+    MusicTrack m_prepared;
+    MusicTrack m_playing;  // Last track sent to the callback
+
+    // Ring buffer: game thread writes m_commandHead, callback writes m_commandTail
+    Command m_commands[COMMAND_CAPACITY];
+    std::atomic<uint32_t> m_commandHead;
+    std::atomic<uint32_t> m_commandTail;
+    std::atomic<const Mix_Chunk*> m_deckChunks[2];  // What the callback still reads
+
+    // Callback only
+    Deck m_decks[2];
+    int m_incoming;  // Deck fading in (or playing)
+    uint32_t m_fadeFrames;
+    uint32_t m_fadeFrame;
+
+    // Loader thread
+    Loader m_loader;
+    std::thread m_loaderThread;
+    std::mutex m_loadMutex;
+    std::condition_variable m_loadWake;
+    std::vector<MusicTrack> m_loadRequests;  // Guarded by m_loadMutex
+    std::vector<std::pair<MusicTrack, Mix_Chunk*>> m_loaded;  // Guarded by m_loadMutex
+    bool m_stopping;                          // Guarded by m_loadMutex
+};
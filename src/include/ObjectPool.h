@@ -0,0 +1,106 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Free-list pool for objects that come and go in bursts (pickups, item boxes).
+// Slots are carved from blocks allocated by reserve(), or on demand when the pool
+// runs dry. A free slot keeps the link to the next free slot in its own storage,
+// so acquire and release are a few pointer moves and never touch the heap once
+// the pool is warm.
+// Objects are handed out as Ptr, a unique_ptr whose deleter puts the slot back;
+// the pool must outlive every Ptr. Not thread-safe.
+template <typename T>
+class ObjectPool {
+public:
+    class Deleter {
+    public:
+        Deleter() : m_pool(nullptr) {}
+        explicit Deleter(ObjectPool* pool) : m_pool(pool) {}
+        void operator()(T* object) const { m_pool->release(object); }
+
+    private:
+        ObjectPool* m_pool;
+    };
+    using Ptr = std::unique_ptr<T, Deleter>;
+
+    explicit ObjectPool(const char* name, size_t blockSize = 32)
+        : m_name(name)
+        , m_blockSize(blockSize > 0 ? blockSize : 1)
+        , m_freeList(nullptr)
+        , m_capacity(0)
+        , m_liveCount(0)
+        , m_allocationCount(0)
+        , m_reserved(false)
+    {
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Grow to at least capacity slots up front; later growth is logged
+    void reserve(size_t capacity) {
+        while (m_capacity < capacity) {
+            addBlock();
+        }
+        m_reserved = true;
+    }
+
+    template <typename... Args>
+    Ptr acquire(Args&&... args) {
+        if (!m_freeList) {
+            if (m_reserved) {
+                SDL_Log("WARNING: %s pool exhausted at %zu, growing", m_name, m_capacity);
+            }
+            addBlock();
+        }
+        Slot* slot = m_freeList;
+        m_freeList = slot->next;
+        T* object = new (slot->storage) T(std::forward<Args>(args)...);
+        m_liveCount++;
+        return Ptr(object, Deleter(this));
+    }
+
+    size_t getLiveCount() const { return m_liveCount; }
+    size_t getCapacity() const { return m_capacity; }
+
+    // Heap allocations made so far (one per block); flat while the pool is warm
+    size_t getAllocationCount() const { return m_allocationCount; }
+
+private:
+    union Slot {
+        Slot* next;  // While free
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void release(T* object) {
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = m_freeList;
+        m_freeList = slot;
+        m_liveCount--;
+    }
+
+    void addBlock() {
+        m_blocks.emplace_back(new Slot[m_blockSize]);
+        Slot* block = m_blocks.back().get();
+        for (size_t i = 0; i < m_blockSize; i++) {
+            block[i].next = i + 1 < m_blockSize ? &block[i + 1] : m_freeList;
+        }
+        m_freeList = block;
+        m_capacity += m_blockSize;
+        m_allocationCount++;
+    }
+
+    const char* m_name;
+    size_t m_blockSize;
+    std::vector<std::unique_ptr<Slot[]>> m_blocks;
+    Slot* m_freeList;
+    size_t m_capacity;
+    size_t m_liveCount;
+    size_t m_allocationCount;
+    bool m_reserved;
+};
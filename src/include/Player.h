@@ -1,5 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <vector>
+#include "RenderSnapshot.h"
 
 class Player {
 public:
@@ -12,12 +14,11 @@ public:
     };
 
     Player(float x, float y);
-    ~Player();
+    ~Player() = default;
 
     void setMousePosition(float mouseX, float mouseY);
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    void render(SDL_Renderer* renderer, SDL_Texture* texture, SDL_Rect* srcRect);
+    void draw(std::vector<SpriteDraw>& out, SpriteId sprite) const;
     
     void clampToScreen(int screenWidth, int screenHeight);
 
@@ -71,6 +72,7 @@ public:
     
     // Reset on death
     void resetOnDeath();
+    void respawn(float x, float y);  // Back at (x, y) with resetOnDeath() applied
     float getSpeed() const { return m_speed; }
     
     // Movement state
@@ -1,6 +1,8 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include <string>
+#include <vector>
+#include "RenderSnapshot.h"
 
 enum class PowerUpType {
     // Main power-ups (need 3 to upgrade)
@@ -36,10 +38,10 @@ enum class PowerUpType {
 class PowerUp {
 public:
     PowerUp(float x, float y, PowerUpType type);
-    ~PowerUp();
+    ~PowerUp() = default;
 
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer, SDL_Texture* sTexture = nullptr, SDL_Texture* lTexture = nullptr, SDL_Texture* mTexture = nullptr);
+    void draw(std::vector<SpriteDraw>& out) const;
 
     float getX() const { return m_x; }
     float getY() const { return m_y; }
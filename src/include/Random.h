@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+
+// Simulation random numbers (PCG32).
+// Owned by Game instead of rand()'s hidden global state, so the generator is
+// part of snapshots and a seeded run replays exactly. Trivially copyable.
+class Random {
+public:
+    explicit Random(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed) {
+        m_state = 0;
+        next();
+        m_state += seed;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t state = m_state;
+        m_state = state * 6364136223846793005ULL + INCREMENT;
+        uint32_t xorShifted = static_cast<uint32_t>(((state >> 18) ^ state) >> 27);
+        uint32_t rotation = static_cast<uint32_t>(state >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    // [0, bound), 0 if bound <= 0 (same use as rand() % bound)
+    int nextInt(int bound) {
+        return bound > 0 ? static_cast<int>(next() % static_cast<uint32_t>(bound)) : 0;
+    }
+
+private:
+    static const uint64_t INCREMENT = 1442695040888963407ULL;
+
+    uint64_t m_state;
+};
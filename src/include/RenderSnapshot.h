@@ -0,0 +1,123 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include <cstdint>
+
+// Immutable render description of one simulation tick.
+// The simulation fills a snapshot with sprite IDs, rectangles and UI values;
+// the render thread resolves sprite IDs to textures and draws it. Nothing in a
+// snapshot points back into live game objects.
+
+enum class SpriteId : uint8_t {
+    NONE,
+    BACKGROUND,      // background.png (legacy)
+    BACKGROUND_01,
+    BACKGROUND_02,
+    BACKGROUND_03,
+    BACKGROUND_04,
+    SHIP_STOP,
+    SHIP_FORWARD,
+    SHIP_BACKWARD,
+    SHIP_LEFT,
+    SHIP_RIGHT,
+    ENEMY_01,
+    ENEMY_02,
+    ENEMY_03,
+    ENEMY_04,
+    ENEMY_05,
+    BOSS_01,
+    BOOM_01,
+    BOOM_02,
+    BOOM_03,
+    BOOM_04,
+    BOOM_05,
+    BOOM_06,
+    ITEM_BOX,
+    ITEM_S,
+    ITEM_L,
+    ITEM_M,
+    COUNT
+};
+
+// One textured quad; drawn as a filled rectangle when the texture is missing
+struct SpriteDraw {
+    SDL_Rect rect;
+    SpriteId sprite;
+    Uint8 alpha;          // Texture alpha mod (255 = opaque)
+    SDL_Color fallback;   // Fill color when the sprite has no texture
+    bool outline;         // Black outline around the fallback fill
+};
+
+// Same-colored rectangles drawn with one SDL_RenderFillRects call
+struct RectBatch {
+    SDL_Color color;
+    std::vector<SDL_Rect> rects;
+};
+
+struct RenderSnapshot {
+    int gameState;        // Game::GameState
+    uint32_t tick;        // Simulation tick that produced this snapshot
+
+    // Scrolling background slots
+    SpriteId background1;
+    SpriteId background2;
+    float backgroundY1;
+    float backgroundY2;
+    SpriteId backgroundNext;  // Segment the next wrap brings in (prefetched)
+
+    // World (back to front)
+    std::vector<SpriteDraw> sprites;
+    RectBatch playerLasers;
+    RectBatch playerMissiles;
+    RectBatch enemyBullets;
+    std::vector<SpriteDraw> pickups;  // Power-ups and item boxes (drawn above bullets)
+
+    // Boss health bar
+    bool bossVisible;
+    int bossHealth;
+    int bossMaxHealth;
+
+    // HUD
+    int score;
+    int highScore;
+    int lives;
+    int speedCount, speedLevel;
+    int laserCount, laserLevel;
+    int missileCount, missileLevel;
+    int energy, maxEnergy;
+
+    // Screen state
+    float stateTimer;
+    float blinkTimer;
+    Uint8 fadeAlpha;
+    SpriteId explosionFrame;   // NONE once the animation is over
+    SDL_Rect explosionRect;
+    int highScores[10];
+    int highScoreCount;
+
+    RenderSnapshot()
+        : gameState(0), tick(0)
+        , background1(SpriteId::NONE), background2(SpriteId::NONE), backgroundY1(0.0f), backgroundY2(0.0f)
+        , backgroundNext(SpriteId::NONE)
+        , playerLasers{{255, 255, 0, 255}, {}}
+        , playerMissiles{{255, 50, 50, 255}, {}}
+        , enemyBullets{{255, 150, 0, 255}, {}}
+        , bossVisible(false), bossHealth(0), bossMaxHealth(1)
+        , score(0), highScore(0), lives(0)
+        , speedCount(0), speedLevel(0), laserCount(0), laserLevel(0), missileCount(0), missileLevel(0)
+        , energy(0), maxEnergy(1)
+        , stateTimer(0.0f), blinkTimer(0.0f), fadeAlpha(0)
+        , explosionFrame(SpriteId::NONE), explosionRect{0, 0, 0, 0}
+        , highScores{}, highScoreCount(0)
+    {
+    }
+
+    // Reset per-tick lists; keeps vector capacity so steady state never allocates
+    void clearDraws() {
+        sprites.clear();
+        playerLasers.rects.clear();
+        playerMissiles.rects.clear();
+        enemyBullets.rects.clear();
+        pickups.clear();
+    }
+};
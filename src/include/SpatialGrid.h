@@ -0,0 +1,115 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Axis-aligned box (top-left corner + size), same layout the entities use
+struct Aabb {
+    float x, y, w, h;
+};
+
+// Uniform grid over the playfield, rebuilt from scratch each time it is used.
+// Items are stored per cell in one flat array (counting sort), so a rebuild
+// does not allocate once the buffers have grown. Boxes outside the bounds are
+// clamped into the edge cells. Within a cell, items keep ascending index order.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 64.0f);
+
+    void setBounds(float minX, float minY, float maxX, float maxY);
+    void reserve(size_t items);  // Room for this many items before build() has to grow
+
+    // bounds(i, box) fills the box of item i and returns false to leave it out
+    template <typename Bounds>
+    void build(size_t count, Bounds bounds);
+
+    int getCellCount() const { return m_columns * m_rows; }
+    int getColumns() const { return m_columns; }
+    const uint32_t* cellBegin(int cell) const { return m_items.data() + m_cellStart[cell]; }
+    const uint32_t* cellEnd(int cell) const { return m_items.data() + m_cellStart[cell + 1]; }
+    const Aabb& getBox(size_t index) const { return m_boxes[index]; }
+
+    int getCell(float x, float y) const;
+    void getCellRange(const Aabb& box, int& minColumn, int& minRow, int& maxColumn, int& maxRow) const;
+
+    // Up to k items closest to (x, y) by squared distance to their box, nearest first.
+    // Searches rings of cells outward and stops once no unvisited cell can hold anything
+    // closer, so the cost follows the distance to the k-th item, not the item count.
+    // Returns how many were found (fewer than k only if the grid holds fewer items).
+    int findNearest(float x, float y, int k, uint32_t* indices, float* distances) const;
+
+    // Strict overlap (touching edges do not count), matching the game's AABB checks
+    static bool overlaps(const Aabb& a, const Aabb& b) {
+        return a.x < b.x + b.w && a.x + a.w > b.x &&
+               a.y < b.y + b.h && a.y + a.h > b.y;
+    }
+
+    // A pair that spans several shared cells is reported only by the cell holding the
+    // top-left corner of their overlap, so each pair is found exactly once
+    bool ownsPair(int cell, const Aabb& a, const Aabb& b) const {
+        float overlapX = a.x > b.x ? a.x : b.x;
+        float overlapY = a.y > b.y ? a.y : b.y;
+        return getCell(overlapX, overlapY) == cell;
+    }
+
+private:
+    int clampColumn(float x) const;
+    int clampRow(float y) const;
+
+    float m_cellSize;
+    float m_invCellSize;
+    float m_minX, m_minY;
+    int m_columns, m_rows;
+    std::vector<uint32_t> m_cellStart;  // Offsets into m_items (cellCount + 1)
+    std::vector<uint32_t> m_cellFill;   // Build scratch
+    std::vector<uint32_t> m_items;      // Item indices grouped by cell
+    std::vector<Aabb> m_boxes;          // Box per item (w < 0 = not in the grid)
+    size_t m_itemCount;                 // Items in the grid (each counted once)
+};
+
+template <typename Bounds>
+void SpatialGrid::build(size_t count, Bounds bounds) {
+    int cellCount = getCellCount();
+    m_cellStart.assign(cellCount + 1, 0);
+    m_boxes.resize(count);
+    m_itemCount = 0;
+    
+    // Pass 1: count items per cell
+    for (size_t i = 0; i < count; i++) {
+        Aabb& box = m_boxes[i];
+        if (!bounds(i, box)) {
+            box.w = -1.0f;
+            continue;
+        }
+        m_itemCount++;
+        int minColumn, minRow, maxColumn, maxRow;
+        getCellRange(box, minColumn, minRow, maxColumn, maxRow);
+        for (int row = minRow; row <= maxRow; row++) {
+            for (int column = minColumn; column <= maxColumn; column++) {
+                m_cellStart[row * m_columns + column + 1]++;
+            }
+        }
+    }
+    
+    // Prefix sum -> cell offsets
+    for (int cell = 0; cell < cellCount; cell++) {
+        m_cellStart[cell + 1] += m_cellStart[cell];
+    }
+    m_items.resize(m_cellStart[cellCount]);
+    m_cellFill.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+    
+    // Pass 2: scatter indices (ascending, so every cell stays sorted)
+    for (size_t i = 0; i < count; i++) {
+        const Aabb& box = m_boxes[i];
+        if (box.w < 0.0f) {
+            continue;
+        }
+        int minColumn, minRow, maxColumn, maxRow;
+        getCellRange(box, minColumn, minRow, maxColumn, maxRow);
+        for (int row = minRow; row <= maxRow; row++) {
+            for (int column = minColumn; column <= maxColumn; column++) {
+                m_items[m_cellFill[row * m_columns + column]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
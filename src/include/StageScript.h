@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <string>
+
+// Stage timeline loaded from a text script and compiled into a sorted event table.
+//
+// Script format (one event per line, '#' starts a comment):
+//   <time> bg <01-04>                           Queue the next background segment
+//   <time> wave <type> <count> <formation> <x> <spacing>
+//                                               Formation: single, line, column, v
+//   <time> random <interval>                    Random enemy spawns (0 = off)
+//   <time> itembox on [interval] | off          Item box zone (ground boxes)
+//   <time> wait kills <n>                       Hold the stage clock until n kills
+//   <time> boss                                 Spawn the stage boss
+// Times are seconds of stage clock. The clock stops while a wait is pending
+// and while the boss is alive, so later events keep their relative spacing.
+
+enum class StageEventType : uint8_t {
+    BACKGROUND,
+    WAVE,
+    RANDOM_SPAWN,
+    ITEM_ZONE,
+    WAIT_KILLS,
+    BOSS
+};
+
+enum class Formation : uint8_t {
+    SINGLE,
+    LINE,     // Horizontal row starting at x
+    COLUMN,   // Vertical file at x
+    V         // V shape centered at x
+};
+
+// Compact, 16 bytes per event
+struct StageEvent {
+    float time;
+    StageEventType type;
+    uint8_t id;         // Background id / enemy type index / item zone on-off
+    uint8_t count;      // Wave size
+    Formation formation;
+    float value;        // Wave x / spawn interval / kill count
+    float spacing;      // Wave spacing
+};
+
+class StageScript {
+public:
+    StageScript();
+    ~StageScript();
+
+    bool loadFromFile(const std::string& path);
+    bool loadFromString(const std::string& text, const char* sourceName);
+    void loadDefault();  // Built-in timeline used when no script file is found
+
+    // O(1) cursor over the sorted table
+    void restart() { m_cursor = 0; }
+    const StageEvent* peekDue(float stageTime) const {
+        if (m_cursor < m_events.size() && m_events[m_cursor].time <= stageTime) {
+            return &m_events[m_cursor];
+        }
+        return nullptr;
+    }
+    void advance() { m_cursor++; }
+    bool isFinished() const { return m_cursor >= m_events.size(); }
+    size_t getCursor() const { return m_cursor; }
+    void seek(size_t cursor) { m_cursor = cursor < m_events.size() ? cursor : m_events.size(); }
+
+    const std::vector<StageEvent>& getEvents() const { return m_events; }
+
+private:
+    bool parseLine(const std::string& line, int lineNumber, const char* sourceName);
+
+    std::vector<StageEvent> m_events;
+    size_t m_cursor;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Flat binary encoding for simulation snapshots (see Game::saveState).
+// Values are raw copies of trivially copyable types, so a buffer is only
+// meaningful to the build that wrote it.
+class StateWriter {
+public:
+    explicit StateWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        size_t offset = m_out.size();
+        m_out.resize(offset + size);
+        std::memcpy(m_out.data() + offset, data, size);
+    }
+
+private:
+    std::vector<uint8_t>& m_out;
+};
+
+// Reads back what StateWriter wrote. Any overrun sets a sticky failure flag.
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_offset(0), m_ok(true) {}
+
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool readBytes(void* out, size_t size) {
+        if (!m_ok || size > m_size - m_offset) {
+            m_ok = false;
+            return false;
+        }
+        std::memcpy(out, m_data + m_offset, size);
+        m_offset += size;
+        return true;
+    }
+
+    // For types without a default constructor: the returned object lives in storage
+    template <typename T>
+    const T* readObject(void* storage) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        if (!readBytes(storage, sizeof(T))) {
+            return nullptr;
+        }
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+
+    bool isOk() const { return m_ok; }
+    bool isFinished() const { return m_ok && m_offset == m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+    bool m_ok;
+};
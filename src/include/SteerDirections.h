@@ -0,0 +1,9 @@
+#pragma once
+
+// Mouse steering shared by the autopilot and AsoEnv actions: the player flies toward
+// the mouse, so a direction is a target placed STEER_DISTANCE away from the ship.
+// 0 = hold position, 1-8 = N, NE, E, SE, S, SW, W, NW (screen y points down).
+const int STEER_DIRECTIONS = 9;
+const float STEER_X[STEER_DIRECTIONS] = {0.0f, 0.0f, 0.7071f, 1.0f, 0.7071f, 0.0f, -0.7071f, -1.0f, -0.7071f};
+const float STEER_Y[STEER_DIRECTIONS] = {0.0f, -1.0f, -0.7071f, 0.0f, 0.7071f, 1.0f, 0.7071f, 0.0f, -0.7071f};
+const float STEER_DISTANCE = 100.0f;  // Beyond the player's mouse dead zone
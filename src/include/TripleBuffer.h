@@ -0,0 +1,43 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer / single-consumer triple buffer.
+// The producer always owns a back buffer and publishes it by swapping with the
+// shared middle slot; the consumer swaps the middle slot into its front buffer
+// only when something new was published. Neither side ever waits on the other.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer()
+        : m_middle(1)
+        , m_back(0)
+        , m_front(2)
+    {
+    }
+
+    // Producer side
+    T& back() { return m_buffers[m_back]; }
+    void publish() {
+        m_back = m_middle.exchange(static_cast<uint8_t>(m_back | FRESH_BIT)) & INDEX_MASK;
+    }
+
+    // Consumer side: returns true if a newer buffer was taken
+    bool acquire() {
+        if (!(m_middle.load() & FRESH_BIT)) {
+            return false;
+        }
+        m_front = m_middle.exchange(static_cast<uint8_t>(m_front)) & INDEX_MASK;
+        return true;
+    }
+    const T& front() const { return m_buffers[m_front]; }
+
+private:
+    static const uint8_t INDEX_MASK = 0x03;
+    static const uint8_t FRESH_BIT = 0x04;
+
+    T m_buffers[3];
+    std::atomic<uint8_t> m_middle;  // Index of middle buffer | FRESH_BIT
+    uint8_t m_back;
+    uint8_t m_front;
+};
@@ -1,30 +1,251 @@
 #include "Game.h"
+#include "AsoEnv.h"
+#include "BalanceSimulator.h"
+#include "AllocationTracker.h"
+#include "Random.h"
 #include <SDL2/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <utility>
 
-const int SCREEN_WIDTH = 437;
-const int SCREEN_HEIGHT = 778;
 const int FPS = 60;
 const int FRAME_DELAY = 1000 / FPS;
 
+// Steps a headless vector env with random actions for a few seconds and reports throughput
+static int runEnvBenchmark() {
+    const int BENCHMARK_SECONDS = 10;
+    
+    // Game logs (spawns, stage changes) from every env would dominate the run
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN);
+    
+    int envCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) * 2;
+    AsoVecEnv envs(envCount);
+    envs.reset(1);
+    
+    Random random;
+    random.reseed(1);
+    std::vector<int> actions(envCount);
+    uint64_t steps = 0;
+    
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    Clock::time_point end = start + std::chrono::seconds(BENCHMARK_SECONDS);
+    while (Clock::now() < end) {
+        for (int batch = 0; batch < 100; batch++) {
+            for (int& action : actions) {
+                action = random.nextInt(AsoEnv::ACTION_COUNT);
+            }
+            envs.step(actions.data());
+        }
+        steps += 100 * static_cast<uint64_t>(envCount);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+    SDL_Log("INFO: Env benchmark: %d envs, %llu steps in %.1fs (%.0f steps/min), %llu episodes finished",
+            envCount, static_cast<unsigned long long>(steps), seconds, steps / seconds * 60.0,
+            static_cast<unsigned long long>(envs.getEpisodeCount()));
+    return 0;
+}
+
+// Simulation only, as fast as it runs, with the autopilot playing game after game.
+// Logs a status line every few seconds; durationSeconds 0 runs until interrupted.
+static int runHeadless(uint64_t seed, int durationSeconds) {
+    const int STATUS_INTERVAL_SECONDS = 10;
+    
+    Game game;
+    if (!game.initHeadless(Game::FIELD_WIDTH, Game::FIELD_HEIGHT, seed)) {
+        SDL_Log("Failed to initialize game!");
+        return -1;
+    }
+    game.setAutopilot(true);
+    SDL_Log("INFO: Headless run, seed %llu, %s", static_cast<unsigned long long>(seed),
+            durationSeconds > 0 ? "time limited" : "until interrupted");
+    
+    // Per-event game logs would bury everything else at this speed; warnings still show
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN);
+    
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    Clock::time_point nextStatus = start + std::chrono::seconds(STATUS_INTERVAL_SECONDS);
+    while (durationSeconds <= 0 || Clock::now() - start < std::chrono::seconds(durationSeconds)) {
+        for (int tick = 0; tick < FPS; tick++) {
+            game.update(1.0f / FPS);
+            ALLOCATION_END_FRAME();
+        }
+        if (Clock::now() >= nextStatus) {
+            nextStatus += std::chrono::seconds(STATUS_INTERVAL_SECONDS);
+            SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+            game.logStatus();
+            SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN);
+        }
+    }
+    
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+    game.logStatus();
+    return 0;
+}
+
+// One value list per tuned setting (--tune name=v1,v2,...)
+typedef std::vector<std::pair<std::string, std::vector<float>>> TuningSweep;
+
+static bool parseTuneArgument(const char* argument, TuningSweep& sweep) {
+    const char* equals = std::strchr(argument, '=');
+    if (!equals) {
+        return false;
+    }
+    std::string name(argument, equals);
+    GameTuning probe;
+    if (!BalanceSimulator::applySetting(probe, name, 0.0f)) {
+        return false;
+    }
+    std::vector<float> values;
+    for (const char* value = equals + 1; *value; ) {
+        char* next = nullptr;
+        values.push_back(std::strtof(value, &next));
+        if (next == value || (*next != ',' && *next != '\0')) {
+            return false;
+        }
+        value = *next == ',' ? next + 1 : next;
+    }
+    if (values.empty()) {
+        return false;
+    }
+    sweep.push_back({name, values});
+    return true;
+}
+
+// Plays every combination of the swept settings (the defaults when nothing is swept)
+// on the same seeded sessions and writes one CSV row per combination
+static int runBalance(const BalanceSimulator::Options& options, const TuningSweep& sweep, const std::string& outPath) {
+    BalanceSimulator simulator(options);
+    std::vector<size_t> choice(sweep.size(), 0);
+    while (true) {
+        GameTuning tuning;
+        std::string label;
+        for (size_t i = 0; i < sweep.size(); i++) {
+            float value = sweep[i].second[choice[i]];
+            BalanceSimulator::applySetting(tuning, sweep[i].first, value);
+            char text[64];
+            std::snprintf(text, sizeof(text), "%s%s=%g", label.empty() ? "" : " ", sweep[i].first.c_str(), value);
+            label += text;
+        }
+        simulator.run(tuning, label.empty() ? "default" : label);
+        
+        // Next combination, last setting fastest
+        size_t i = sweep.size();
+        while (i > 0 && ++choice[i - 1] == sweep[i - 1].second.size()) {
+            choice[--i] = 0;
+        }
+        if (i == 0) {
+            break;
+        }
+    }
+    
+    if (!simulator.writeCsv(outPath)) {
+        return -1;
+    }
+    SDL_Log("INFO: Balance report written to %s", outPath.c_str());
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
+    // --single-thread: run simulation and rendering on one thread (legacy loop)
+    // --allocation-assert: assert on allocation budget violations (ASO_TRACK_ALLOCATIONS builds)
+    // --env-benchmark: measure headless AsoVecEnv throughput, no window
+    // --autopilot: the game plays itself (steers, fires, restarts)
+    // --headless: no window or audio, unthrottled, implies --autopilot (soak runs)
+    //   --duration <seconds>: stop after this much wall time (default: run until interrupted)
+    //   --seed <n>: RNG seed (default: current time)
+    // --balance <sessions>: Monte Carlo balance run on every core, CSV report, no window
+    //   --balance-out <path>: report file (default: balance.csv)
+    //   --tune <name>=<v1>[,<v2>...]: sweep a GameTuning value (repeat for a grid);
+    //     names are the report's columns: drop_speed ... drop_penalty, enemy_cooldown,
+    //     boss_health, boss_damage, weak_point_damage
+    //   --seed <n>: session i plays seed + i (default: 1, so reports are comparable)
+    bool threaded = true;
+    bool allocationAssert = false;
+    bool autopilot = false;
+    bool headless = false;
+    int durationSeconds = 0;
+    uint64_t seed = static_cast<uint64_t>(time(nullptr));
+    bool seedGiven = false;
+    int balanceSessions = 0;
+    std::string balanceOut = "balance.csv";
+    TuningSweep sweep;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--single-thread") == 0) {
+            threaded = false;
+        } else if (std::strcmp(argv[i], "--allocation-assert") == 0) {
+            allocationAssert = true;
+        } else if (std::strcmp(argv[i], "--env-benchmark") == 0) {
+            return runEnvBenchmark();
+        } else if (std::strcmp(argv[i], "--autopilot") == 0) {
+            autopilot = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+            durationSeconds = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            seedGiven = true;
+        } else if (std::strcmp(argv[i], "--balance") == 0 && i + 1 < argc) {
+            balanceSessions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--balance-out") == 0 && i + 1 < argc) {
+            balanceOut = argv[++i];
+        } else if (std::strcmp(argv[i], "--tune") == 0 && i + 1 < argc) {
+            if (!parseTuneArgument(argv[++i], sweep)) {
+                SDL_Log("WARNING: Ignoring invalid --tune %s", argv[i]);
+            }
+        }
+    }
+    ALLOCATION_ASSERT_BUDGETS(allocationAssert);
+    
+    if (balanceSessions > 0) {
+        BalanceSimulator::Options options;
+        options.sessions = balanceSessions;
+        options.seed = seedGiven ? seed : 1;
+        return runBalance(options, sweep, balanceOut);
+    }
+    if (headless) {
+        return runHeadless(seed, durationSeconds);
+    }
+
     Game game;
 
-    if (!game.init("2D Shooting Game", SCREEN_WIDTH, SCREEN_HEIGHT)) {
+    if (!game.init("2D Shooting Game", Game::FIELD_WIDTH, Game::FIELD_HEIGHT)) {
         SDL_Log("Failed to initialize game!");
         return -1;
     }
+    if (autopilot) {
+        game.setAutopilot(true);
+    }
 
     Uint32 frameStart;
     int frameTime;
     float deltaTime = 0.016f; // 초기값 (약 60 FPS)
 
+    if (threaded) {
+        // Simulation ticks on its own thread; this loop only polls events and draws
+        game.startSimulationThread(1.0f / FPS);
+    }
+
     // 게임 루프
     while (game.isRunning()) {
         frameStart = SDL_GetTicks();
 
         game.handleEvents();
-        game.update(deltaTime);
+        if (!threaded) {
+            game.update(deltaTime);
+        }
         game.render();
+        ALLOCATION_END_FRAME();
 
         frameTime = SDL_GetTicks() - frameStart;
 
@@ -38,6 +259,7 @@ int main(int argc, char* argv[]) {
         deltaTime = frameTime / 1000.0f;
     }
 
+    game.stopSimulationThread();
     game.clean();
 
     return 0;
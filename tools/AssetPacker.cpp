@@ -0,0 +1,159 @@
+// Packs every file in an asset directory into assets.pak (see AssetArchive.h).
+// PNG/JPG images are decoded here so the game can upload them straight from
+// the mapped archive; everything else is copied as is.
+//
+// Usage: AssetPacker <asset directory> <output file>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include "AssetArchive.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct PackedAsset {
+    AssetArchive::Entry entry;
+    std::vector<uint8_t> data;
+};
+
+static bool isImage(const fs::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg";
+}
+
+static bool readFile(const fs::path& path, std::vector<uint8_t>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Decode to RGBA32 so the runtime needs no conversion before upload
+static bool decodeImage(const std::vector<uint8_t>& bytes, PackedAsset& asset) {
+    SDL_RWops* rw = SDL_RWFromConstMem(bytes.data(), static_cast<int>(bytes.size()));
+    SDL_Surface* decoded = rw ? IMG_Load_RW(rw, 1) : nullptr;
+    if (!decoded) {
+        return false;
+    }
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(decoded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(decoded);
+    if (!converted) {
+        return false;
+    }
+
+    asset.entry.type = AssetArchive::AssetType::IMAGE;
+    asset.entry.width = static_cast<uint32_t>(converted->w);
+    asset.entry.height = static_cast<uint32_t>(converted->h);
+    asset.entry.pitch = static_cast<uint32_t>(converted->pitch);
+    asset.entry.pixelFormat = SDL_PIXELFORMAT_RGBA32;
+    const uint8_t* pixels = static_cast<const uint8_t*>(converted->pixels);
+    asset.data.assign(pixels, pixels + static_cast<size_t>(converted->pitch) * converted->h);
+    SDL_FreeSurface(converted);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: %s <asset directory> <output file>\n", argv[0]);
+        return 1;
+    }
+    fs::path assetDir = argv[1];
+    fs::path outputPath = argv[2];
+
+    int imgFlags = IMG_INIT_PNG | IMG_INIT_JPG;
+    if (!(IMG_Init(imgFlags) & IMG_INIT_PNG)) {
+        std::fprintf(stderr, "Failed to initialize SDL_image: %s\n", IMG_GetError());
+        return 1;
+    }
+
+    std::vector<PackedAsset> assets;
+    std::error_code error;
+    for (const fs::directory_entry& file : fs::directory_iterator(assetDir, error)) {
+        if (!file.is_regular_file()) {
+            continue;
+        }
+        std::string name = file.path().filename().string();
+        if (name.size() > AssetArchive::MAX_NAME_LENGTH) {
+            std::fprintf(stderr, "Skipping %s: name longer than %zu characters\n", name.c_str(), AssetArchive::MAX_NAME_LENGTH);
+            continue;
+        }
+
+        PackedAsset asset;
+        std::memset(&asset.entry, 0, sizeof(asset.entry));
+        std::vector<uint8_t> bytes;
+        if (!readFile(file.path(), bytes)) {
+            std::fprintf(stderr, "Failed to read %s\n", name.c_str());
+            return 1;
+        }
+        std::memcpy(asset.entry.name, name.c_str(), name.size());
+        asset.entry.nameHash = AssetArchive::hash(name.data(), name.size());
+        asset.entry.contentHash = AssetArchive::hash(bytes.data(), bytes.size());
+
+        if (!isImage(file.path()) || !decodeImage(bytes, asset)) {
+            if (isImage(file.path())) {
+                std::fprintf(stderr, "Warning: could not decode %s, storing raw: %s\n", name.c_str(), IMG_GetError());
+            }
+            asset.entry.type = AssetArchive::AssetType::RAW;
+            asset.data.swap(bytes);
+        }
+        asset.entry.size = asset.data.size();
+        assets.push_back(std::move(asset));
+    }
+    if (error) {
+        std::fprintf(stderr, "Failed to list %s: %s\n", assetDir.string().c_str(), error.message().c_str());
+        return 1;
+    }
+
+    // Index sorted by name hash (binary search at runtime); ties by name keep output stable
+    std::sort(assets.begin(), assets.end(), [](const PackedAsset& a, const PackedAsset& b) {
+        if (a.entry.nameHash != b.entry.nameHash) return a.entry.nameHash < b.entry.nameHash;
+        return std::strcmp(a.entry.name, b.entry.name) < 0;
+    });
+
+    AssetArchive::Header header = {};
+    header.magic = AssetArchive::MAGIC;
+    header.version = AssetArchive::VERSION;
+    header.entryCount = static_cast<uint32_t>(assets.size());
+
+    uint64_t offset = sizeof(header) + sizeof(AssetArchive::Entry) * assets.size();
+    for (PackedAsset& asset : assets) {
+        offset = (offset + AssetArchive::DATA_ALIGNMENT - 1) & ~static_cast<uint64_t>(AssetArchive::DATA_ALIGNMENT - 1);
+        asset.entry.offset = offset;
+        offset += asset.entry.size;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        std::fprintf(stderr, "Failed to create %s\n", outputPath.string().c_str());
+        return 1;
+    }
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const PackedAsset& asset : assets) {
+        output.write(reinterpret_cast<const char*>(&asset.entry), sizeof(asset.entry));
+    }
+    for (const PackedAsset& asset : assets) {
+        while (static_cast<uint64_t>(output.tellp()) < asset.entry.offset) {
+            output.put('\0');
+        }
+        output.write(reinterpret_cast<const char*>(asset.data.data()), static_cast<std::streamsize>(asset.data.size()));
+    }
+    if (!output) {
+        std::fprintf(stderr, "Failed to write %s\n", outputPath.string().c_str());
+        return 1;
+    }
+
+    std::printf("Packed %zu assets into %s (%llu bytes)\n", assets.size(), outputPath.string().c_str(),
+                static_cast<unsigned long long>(offset));
+    IMG_Quit();
+    return 0;
+}